@@ -0,0 +1,59 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+ROOT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+OUT_DIR="${ROOT_DIR}/artifacts/simulator"
+CXX_BIN="${CXX:-c++}"
+
+if ! command -v "${CXX_BIN}" >/dev/null 2>&1; then
+  echo "C++ compiler '${CXX_BIN}' not found. Install g++/clang++ or set CXX=/path/to/compiler." >&2
+  exit 1
+fi
+
+mkdir -p "${OUT_DIR}"
+
+# sim-bench by default; `build_sim_native.sh golden` builds sim-golden (golden-frame capture/check),
+# `build_sim_native.sh upload` sim-upload (upload parser bench/check, no simulator core),
+# `build_sim_native.sh flipbook` sim-flipbook (flipbook encode/decode bench),
+# `build_sim_native.sh realtime` sim-realtime (E1.31/DDP receiver check and loopback bench),
+# `build_sim_native.sh events` sim-events (/events fan-out check, no simulator core),
+# `build_sim_native.sh palette` sim-palette (color scheme check and bench, no simulator core),
+# `build_sim_native.sh simd` sim-simd (framebuffer kernels against scalar code, no simulator core)
+TOOL="${1:-bench}"
+case "${TOOL}" in
+  bench|golden|upload|flipbook|realtime|events|palette|simd) ;;
+  *) echo "Unknown tool '${TOOL}' (expected bench, golden, upload, flipbook, realtime, events, palette or simd)" >&2; exit 1 ;;
+esac
+
+echo "[sim-native] Building sim-${TOOL} with ${CXX_BIN}"
+
+# SIMD framebuffer kernels (src/sim_simd.h): SSE2 by default on x86-64,
+# SIM_SIMD=avx2 adds -mavx2, SIM_SIMD=0 builds the scalar fallback
+SIMD_FLAGS=()
+case "${SIM_SIMD:-1}" in
+  0) ;;
+  avx2) SIMD_FLAGS=(-mavx2 -DSIM_SIMD) ;;
+  *) SIMD_FLAGS=(-DSIM_SIMD) ;;
+esac
+
+PATTERN_SRCS=$(ls "${ROOT_DIR}"/src/patterns/*.cpp | tr '\n' ' ')
+CORE_SRCS="${ROOT_DIR}/sim/wasm/sim_core.cpp ${PATTERN_SRCS}"
+if [[ "${TOOL}" == "upload" || "${TOOL}" == "events" || "${TOOL}" == "simd" ]]; then
+  CORE_SRCS=""
+elif [[ "${TOOL}" == "realtime" ]]; then
+  CORE_SRCS="${ROOT_DIR}/src/patterns/led_map.cpp"
+elif [[ "${TOOL}" == "palette" ]]; then
+  CORE_SRCS="${ROOT_DIR}/src/patterns/palette.cpp"
+fi
+
+"${CXX_BIN}" \
+  -std=c++17 -O2 \
+  -DSIMULATOR -DSIM_NATIVE \
+  "${SIMD_FLAGS[@]}" \
+  -I"${ROOT_DIR}/src" \
+  "${ROOT_DIR}/sim/native/sim_${TOOL}.cpp" \
+  ${CORE_SRCS} \
+  -o "${OUT_DIR}/sim-${TOOL}"
+
+echo "[sim-native] Output:"
+echo "  ${OUT_DIR}/sim-${TOOL}"
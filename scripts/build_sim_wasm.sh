@@ -28,26 +28,48 @@ mkdir -p "${OUT_DIR}"
 
 echo "[sim-wasm] Building sim core with ${EMCC_BIN}"
 
-PATTERN_SRCS=$(ls "${ROOT_DIR}"/src/patterns/pattern_*.cpp | tr '\n' ' ')
-FONT_SRC="${ROOT_DIR}/src/patterns/font.cpp"
+# SIMD framebuffer kernels (src/sim_simd.h): SIM_SIMD=0 builds the scalar fallback
+SIMD_FLAGS=()
+if [[ "${SIM_SIMD:-1}" != "0" ]]; then
+  SIMD_FLAGS=(-msimd128 -DSIM_SIMD)
+fi
+
+PATTERN_SRCS=$(ls "${ROOT_DIR}"/src/patterns/*.cpp | tr '\n' ' ')
 
 "${EMCC_BIN}" \
   -std=c++17 -O2 \
   -DSIMULATOR -DSIM_WASM \
+  "${SIMD_FLAGS[@]}" \
   -I"${ROOT_DIR}/src" \
   "${ROOT_DIR}/sim/wasm/sim_core.cpp" \
   ${PATTERN_SRCS} \
-  "${FONT_SRC}" \
   -o "${OUT_DIR}/sim-core.js" \
   -sALLOW_MEMORY_GROWTH=1 \
   -sMODULARIZE=1 \
   -sEXPORT_ES6=1 \
   -sEXPORT_NAME=createSimModule \
   -sENVIRONMENT=web,worker \
-  -sEXPORTED_FUNCTIONS='[_sim_init,_sim_set_pattern,_sim_set_scroll_speed,_sim_set_text,_sim_seed,_sim_step,_sim_get_buffer,_sim_get_buffer_length,_sim_get_led_count,_sim_get_grid_width,_sim_get_grid_height]' \
-  -sEXPORTED_RUNTIME_METHODS='[cwrap,ccall,HEAPU8]' \
+  -sEXPORTED_FUNCTIONS='[_sim_init,_sim_set_pattern,_sim_set_scroll_speed,_sim_set_text,_sim_set_palette,_sim_seed,_sim_step,_sim_step_n,_sim_get_frame_index,_sim_get_frame_meta_size,_sim_get_buffer,_sim_set_output,_sim_set_power_budget,_sim_get_power_mw,_sim_get_power_history,_sim_get_stats,_sim_reset_stats,_sim_set_trace,_sim_get_trace_count,_sim_set_flipbook,_sim_get_buffer_length,_sim_get_send_count,_sim_get_led_count,_sim_get_grid_width,_sim_get_grid_height,_sim_set_layout,_sim_get_led_map,_sim_get_pattern_count,_sim_get_pattern_id,_sim_get_pattern_name,_sim_get_pattern_flags,_sim_get_palette_count,_sim_get_palette_name]' \
+  -sEXPORTED_RUNTIME_METHODS='[cwrap,ccall,HEAPU8,HEAPU16,HEAPU32,UTF8ToString]' \
   -sFORCE_FILESYSTEM=0
 
+# Golden-frame tool on the WASM core, run with node against the host filesystem
+# (`make sim-golden-check-wasm`)
+"${EMCC_BIN}" \
+  -std=c++17 -O2 \
+  -DSIMULATOR -DSIM_WASM \
+  "${SIMD_FLAGS[@]}" \
+  -I"${ROOT_DIR}/src" \
+  "${ROOT_DIR}/sim/wasm/sim_core.cpp" \
+  "${ROOT_DIR}/sim/native/sim_golden.cpp" \
+  ${PATTERN_SRCS} \
+  -o "${OUT_DIR}/sim-golden.js" \
+  -sALLOW_MEMORY_GROWTH=1 \
+  -sENVIRONMENT=node \
+  -sNODERAWFS=1 \
+  -sEXIT_RUNTIME=1
+
 echo "[sim-wasm] Output:"
 echo "  ${OUT_DIR}/sim-core.js"
 echo "  ${OUT_DIR}/sim-core.wasm"
+echo "  ${OUT_DIR}/sim-golden.js (node)"
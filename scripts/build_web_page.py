@@ -0,0 +1,78 @@
+#!/usr/bin/env python3
+"""Compresses the device's root page (web/device/index.html) into src/index_html_gz.h.
+
+The firmware serves the gzip bytes from flash as they are (Content-Encoding: gzip), with
+an ETag derived from the page source, so a browser that already has the page gets a 304.
+
+  scripts/build_web_page.py           regenerate the header
+  scripts/build_web_page.py --check   exit 1 if the header does not match the page
+"""
+
+import gzip
+import hashlib
+import re
+import sys
+from pathlib import Path
+
+ROOT = Path(__file__).resolve().parent.parent
+SOURCE = ROOT / "web" / "device" / "index.html"
+HEADER = ROOT / "src" / "index_html_gz.h"
+
+
+def etag(page: bytes) -> str:
+    return hashlib.sha1(page).hexdigest()[:16]
+
+
+def render(page: bytes) -> str:
+    data = gzip.compress(page, compresslevel=9, mtime=0)
+    rows = []
+    for i in range(0, len(data), 16):
+        rows.append("  " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+    return (
+        "// Generated by scripts/build_web_page.py from web/device/index.html - do not edit;\n"
+        "// `make web-page` regenerates it.\n"
+        "#ifndef INDEX_HTML_GZ_H\n"
+        "#define INDEX_HTML_GZ_H\n"
+        "\n"
+        "#include \"platform.h\"\n"
+        "\n"
+        "// %d bytes of HTML, %d gzipped\n"
+        "static const char kIndexHtmlEtag[] = \"\\\"%s\\\"\";\n"
+        "static const size_t kIndexHtmlGzLength = %d;\n"
+        "static const uint8_t kIndexHtmlGz[] PROGMEM = {\n"
+        "%s\n"
+        "};\n"
+        "\n"
+        "#endif // INDEX_HTML_GZ_H\n"
+    ) % (len(page), len(data), etag(page), len(data), "\n".join(rows))
+
+
+def check(page: bytes) -> bool:
+    if not HEADER.exists():
+        print("%s is missing; run make web-page" % HEADER.relative_to(ROOT), file=sys.stderr)
+        return False
+    text = HEADER.read_text()
+    body = text[text.index("PROGMEM = {"):]
+    data = bytes(int(b, 16) for b in re.findall(r"0x([0-9a-f]{2})", body))
+    tag = re.search(r'kIndexHtmlEtag\[\] = "\\"([0-9a-f]+)\\""', text)
+    length = re.search(r"kIndexHtmlGzLength = (\d+);", text)
+    ok = (tag is not None and tag.group(1) == etag(page) and length is not None
+          and int(length.group(1)) == len(data) and gzip.decompress(data) == page)
+    if not ok:
+        print("%s is out of date with %s; run make web-page"
+              % (HEADER.relative_to(ROOT), SOURCE.relative_to(ROOT)), file=sys.stderr)
+    return ok
+
+
+def main() -> int:
+    page = SOURCE.read_bytes()
+    if "--check" in sys.argv[1:]:
+        return 0 if check(page) else 1
+    HEADER.write_text(render(page))
+    print("[web-page] %s: %d bytes, %d gzipped"
+          % (HEADER.relative_to(ROOT), len(page), len(gzip.compress(page, compresslevel=9, mtime=0))))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
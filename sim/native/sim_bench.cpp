@@ -0,0 +1,362 @@
+// Native headless benchmark: drives the simulator core (sim/wasm/sim_core.cpp) on a
+// deterministic clock and reports per-pattern render cost as JSON.
+// Built by scripts/build_sim_native.sh with the SIMULATOR shims from platform.h.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "../wasm/sim_core.h"
+
+static const int kPattern2D = 0x01;  // PATTERN_2D in src/pattern_registry.h
+static const int kMaxLeds = 1500;    // MAX_LEDS in src/platform.h
+
+struct BenchPattern {
+  int id;
+  const char* name;
+};
+
+// 2D patterns in registry order (the firmware-only 1D table is not compiled in here).
+static std::vector<BenchPattern> listPatterns() {
+  std::vector<BenchPattern> list;
+  for (int i = 0; i < sim_get_pattern_count(); i++) {
+    if (!(sim_get_pattern_flags(i) & kPattern2D)) continue;
+    list.push_back({sim_get_pattern_id(i), sim_get_pattern_name(i)});
+  }
+  return list;
+}
+
+struct BenchOptions {
+  int frames = 2000;
+  int warmup = 50;
+  uint32_t deltaMs = 20;       // firmware tick (EVERY_N_MILLISECONDS(20) in loop())
+  uint32_t seed = 12345;
+  std::vector<int> only;       // empty = every pattern
+  const char* outPath = nullptr;
+  const char* comparePath = nullptr;
+  double threshold = 15.0;     // percent slowdown that counts as a regression
+  bool panel = false;          // firmware output stage (brightness 64, TypicalLEDStrip) instead of raw
+  uint32_t budgetMw = 0;       // power limit, 0 = none
+  const char* tracePath = nullptr;  // Chrome trace of the timed frames
+};
+
+struct BenchResult {
+  int id;
+  const char* name;
+  double meanNs;
+  double p50Ns;
+  double p99Ns;
+  double minNs;
+  double maxNs;
+  double fps;
+  double changedPct;           // frames the firmware would actually send (FastLED.show())
+  double wirePct;              // LEDs clocked out per frame, as % of a full MAX_LEDS show()
+  double avgMw;                // estimated draw at 5 V (OutputStage power model), mean over frames
+  uint32_t peakMw;             // ...and the highest single frame
+  uint32_t hash;               // FNV-1a of the final frame, to spot output changes
+};
+
+static uint32_t fnv1a(const uint8_t* data, int len) {
+  uint32_t h = 2166136261u;
+  for (int i = 0; i < len; i++) {
+    h ^= data[i];
+    h *= 16777619u;
+  }
+  return h;
+}
+
+static double percentile(std::vector<double>& sorted, double pct) {
+  if (sorted.empty()) return 0.0;
+  size_t idx = static_cast<size_t>(pct / 100.0 * (sorted.size() - 1) + 0.5);
+  return sorted[std::min(idx, sorted.size() - 1)];
+}
+
+// Chrome trace (chrome://tracing, Perfetto) "complete" events, one per render / show phase
+struct TraceEvent {
+  int id;
+  const char* name;
+  uint32_t phase;
+  uint64_t startNs;
+  uint32_t durNs;
+};
+static std::vector<TraceEvent> traceEvents;
+static uint64_t traceClock = 0;  // unwrapped sim_set_trace() clock
+static uint32_t traceLast = 0;
+
+static void appendTrace(const BenchPattern& p, const uint32_t* events, int count) {
+  for (int i = 0; i < count; i++) {
+    const uint32_t* e = events + 4 * i;
+    traceClock += static_cast<uint32_t>(e[2] - traceLast);  // the recorded clock wraps every 4.3 s
+    traceLast = e[2];
+    traceEvents.push_back({p.id, p.name, e[0], traceClock, e[3]});
+  }
+}
+
+static bool writeTrace(const char* path) {
+  FILE* f = fopen(path, "w");
+  if (!f) return false;
+  static const char* const kPhases[] = {"render", "show", "http"};
+  uint64_t origin = traceEvents.empty() ? 0 : traceEvents.front().startNs;
+  fprintf(f, "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [\n");
+  for (const TraceEvent& e : traceEvents) {
+    fprintf(f,
+            "  {\"name\": \"%s\", \"cat\": \"%s\", \"ph\": \"X\", \"ts\": %.3f, \"dur\": %.3f, \"pid\": 1, "
+            "\"tid\": %u, \"args\": {\"pattern\": %d}},\n",
+            e.name, kPhases[e.phase < 3 ? e.phase : 0], (e.startNs - origin) / 1000.0, e.durNs / 1000.0,
+            e.phase + 1, e.id);
+  }
+  fprintf(f, "  {\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": 1, \"args\": {\"name\": \"render\"}},\n");
+  fprintf(f, "  {\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": 2, \"args\": {\"name\": \"show\"}}\n");
+  fprintf(f, "]}\n");
+  return fclose(f) == 0;
+}
+
+static BenchResult runPattern(const BenchPattern& p, const BenchOptions& opt) {
+  using clock = std::chrono::steady_clock;
+
+  sim_init(sim_get_grid_width(), sim_get_grid_height());
+  sim_seed(opt.seed);
+  if (opt.panel) {
+    sim_set_output(64, 10, 0xFFB0F0);  // BRIGHTNESS and setup() in src/main.cpp
+  } else {
+    sim_set_output(255, 10, 0xFFFFFF);
+  }
+  sim_set_power_budget(opt.budgetMw);
+  sim_set_pattern(p.id);
+
+  for (int i = 0; i < opt.warmup; i++) {
+    sim_step(opt.deltaMs);
+  }
+
+  // Phase events of the timed frames for --trace (render + show per frame)
+  static std::vector<uint32_t> events;
+  if (opt.tracePath) {
+    events.assign(static_cast<size_t>(opt.frames) * 2 * 4, 0);
+    sim_set_trace(events.data(), opt.frames * 2);
+  }
+
+  std::vector<double> samples(opt.frames);
+  int changedFrames = 0;
+  double sentLeds = 0.0;
+  double totalMw = 0.0;
+  uint32_t peakMw = 0;
+  for (int i = 0; i < opt.frames; i++) {
+    auto t0 = clock::now();
+    sim_step(opt.deltaMs);
+    auto t1 = clock::now();
+    samples[i] = std::chrono::duration<double, std::nano>(t1 - t0).count();
+    int sent = sim_get_send_count();
+    changedFrames += sent > 0 ? 1 : 0;
+    sentLeds += sent;
+    uint32_t mw = sim_get_power_mw();
+    totalMw += mw;
+    peakMw = std::max(peakMw, mw);
+  }
+
+  if (opt.tracePath) {
+    appendTrace(p, events.data(), sim_get_trace_count());
+    sim_set_trace(nullptr, 0);
+  }
+
+  double total = 0.0;
+  for (double s : samples) total += s;
+  std::sort(samples.begin(), samples.end());
+
+  BenchResult r;
+  r.id = p.id;
+  r.name = p.name;
+  r.meanNs = total / opt.frames;
+  r.p50Ns = percentile(samples, 50.0);
+  r.p99Ns = percentile(samples, 99.0);
+  r.minNs = samples.front();
+  r.maxNs = samples.back();
+  r.fps = r.meanNs > 0.0 ? 1e9 / r.meanNs : 0.0;
+  r.changedPct = changedFrames * 100.0 / opt.frames;
+  r.wirePct = sentLeds * 100.0 / (static_cast<double>(opt.frames) * kMaxLeds);
+  r.avgMw = totalMw / opt.frames;
+  r.peakMw = peakMw;
+  r.hash = fnv1a(sim_get_buffer(), sim_get_buffer_length());
+  return r;
+}
+
+// One pattern object per line so compare mode (and grep/diff) can read it back
+// without a JSON library.
+static void writeJson(FILE* f, const BenchOptions& opt, const std::vector<BenchResult>& results) {
+  fprintf(f, "{\n");
+  fprintf(f, "  \"frames\": %d,\n", opt.frames);
+  fprintf(f, "  \"warmup\": %d,\n", opt.warmup);
+  fprintf(f, "  \"delta_ms\": %u,\n", opt.deltaMs);
+  fprintf(f, "  \"seed\": %u,\n", opt.seed);
+  fprintf(f, "  \"grid\": [%d, %d],\n", sim_get_grid_width(), sim_get_grid_height());
+  fprintf(f, "  \"output\": \"%s\",\n", opt.panel ? "panel" : "raw");
+  fprintf(f, "  \"budget_mw\": %u,\n", opt.budgetMw);
+  fprintf(f, "  \"patterns\": [\n");
+  for (size_t i = 0; i < results.size(); i++) {
+    const BenchResult& r = results[i];
+    fprintf(f,
+            "    {\"id\": %d, \"name\": \"%s\", \"ns_per_frame\": %.1f, \"p50_ns\": %.1f, "
+            "\"p99_ns\": %.1f, \"min_ns\": %.1f, \"max_ns\": %.1f, \"fps\": %.1f, \"changed_pct\": %.1f, \"wire_pct\": %.1f, "
+            "\"avg_mw\": %.0f, \"peak_mw\": %u, \"hash\": \"%08x\"}%s\n",
+            r.id, r.name, r.meanNs, r.p50Ns, r.p99Ns, r.minNs, r.maxNs, r.fps, r.changedPct, r.wirePct, r.avgMw,
+            r.peakMw, r.hash,
+            (i + 1 < results.size()) ? "," : "");
+  }
+  fprintf(f, "  ]\n");
+  fprintf(f, "}\n");
+}
+
+struct BaselineEntry {
+  int id;
+  double meanNs;
+  uint32_t hash;
+};
+
+static bool readNumberAfter(const char* line, const char* key, double& out) {
+  const char* p = strstr(line, key);
+  if (!p) return false;
+  p += strlen(key);
+  while (*p == ' ' || *p == ':' || *p == '"') p++;
+  out = strtod(p, nullptr);
+  return true;
+}
+
+static bool loadBaseline(const char* path, std::vector<BaselineEntry>& out) {
+  FILE* f = fopen(path, "r");
+  if (!f) return false;
+  char line[512];
+  while (fgets(line, sizeof(line), f)) {
+    double id = 0, mean = 0;
+    if (!readNumberAfter(line, "\"id\"", id) || !readNumberAfter(line, "\"ns_per_frame\"", mean)) {
+      continue;
+    }
+    BaselineEntry e;
+    e.id = static_cast<int>(id);
+    e.meanNs = mean;
+    e.hash = 0;
+    const char* h = strstr(line, "\"hash\": \"");
+    if (h) e.hash = static_cast<uint32_t>(strtoul(h + 9, nullptr, 16));
+    out.push_back(e);
+  }
+  fclose(f);
+  return true;
+}
+
+// Prints a per-pattern delta table; returns the number of regressions.
+static int compareWithBaseline(const std::vector<BaselineEntry>& base,
+                               const std::vector<BenchResult>& results, double threshold) {
+  int regressions = 0;
+  fprintf(stderr, "%-4s %-20s %12s %12s %8s  %s\n", "id", "name", "base ns", "now ns", "delta", "");
+  for (const BenchResult& r : results) {
+    const BaselineEntry* b = nullptr;
+    for (const BaselineEntry& e : base) {
+      if (e.id == r.id) { b = &e; break; }
+    }
+    if (!b) {
+      fprintf(stderr, "%-4d %-20s %12s %12.1f %8s  new\n", r.id, r.name, "-", r.meanNs, "-");
+      continue;
+    }
+    double delta = b->meanNs > 0.0 ? (r.meanNs - b->meanNs) * 100.0 / b->meanNs : 0.0;
+    const char* note = "";
+    if (delta > threshold) {
+      note = "REGRESSION";
+      regressions++;
+    }
+    bool outputChanged = b->hash != 0 && b->hash != r.hash;
+    fprintf(stderr, "%-4d %-20s %12.1f %12.1f %+7.1f%%  %s%s\n", r.id, r.name, b->meanNs, r.meanNs,
+            delta, note, outputChanged ? " (output changed)" : "");
+  }
+  return regressions;
+}
+
+static void usage(const char* argv0) {
+  fprintf(stderr,
+          "Usage: %s [options]\n"
+          "  --frames N        timed frames per pattern (default 2000)\n"
+          "  --warmup N        untimed frames before measuring (default 50)\n"
+          "  --delta MS        simulated ms per frame (default 20)\n"
+          "  --seed S          random seed applied before each pattern (default 12345)\n"
+          "  --pattern ID      only run this pattern (repeatable)\n"
+          "  --out FILE        write JSON to FILE instead of stdout\n"
+          "  --compare FILE    compare against a stored baseline JSON, exit 1 on regression\n"
+          "  --threshold PCT   slowdown that counts as a regression (default 15)\n"
+          "  --panel           apply the firmware output stage (brightness 64, TypicalLEDStrip)\n"
+          "  --budget MW       power limit for the output stage, 0 = none (default 0)\n"
+          "  --trace FILE      write the timed frames' render/show phases as a Chrome trace\n",
+          argv0);
+}
+
+int main(int argc, char** argv) {
+  BenchOptions opt;
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    bool hasValue = i + 1 < argc;
+    if (arg == "--frames" && hasValue) {
+      opt.frames = std::max(1, atoi(argv[++i]));
+    } else if (arg == "--warmup" && hasValue) {
+      opt.warmup = std::max(0, atoi(argv[++i]));
+    } else if (arg == "--delta" && hasValue) {
+      opt.deltaMs = static_cast<uint32_t>(std::max(1, atoi(argv[++i])));
+    } else if (arg == "--seed" && hasValue) {
+      opt.seed = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 0));
+    } else if (arg == "--pattern" && hasValue) {
+      opt.only.push_back(atoi(argv[++i]));
+    } else if (arg == "--out" && hasValue) {
+      opt.outPath = argv[++i];
+    } else if (arg == "--compare" && hasValue) {
+      opt.comparePath = argv[++i];
+    } else if (arg == "--threshold" && hasValue) {
+      opt.threshold = atof(argv[++i]);
+    } else if (arg == "--panel") {
+      opt.panel = true;
+    } else if (arg == "--budget" && hasValue) {
+      opt.budgetMw = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 0));
+    } else if (arg == "--trace" && hasValue) {
+      opt.tracePath = argv[++i];
+    } else {
+      usage(argv[0]);
+      return 2;
+    }
+  }
+
+  std::vector<BenchResult> results;
+  for (const BenchPattern& p : listPatterns()) {
+    if (!opt.only.empty() && std::find(opt.only.begin(), opt.only.end(), p.id) == opt.only.end()) {
+      continue;
+    }
+    results.push_back(runPattern(p, opt));
+  }
+
+  FILE* out = stdout;
+  if (opt.outPath) {
+    out = fopen(opt.outPath, "w");
+    if (!out) {
+      fprintf(stderr, "Cannot write %s\n", opt.outPath);
+      return 1;
+    }
+  }
+  writeJson(out, opt, results);
+  if (out != stdout) fclose(out);
+  if (opt.tracePath && !writeTrace(opt.tracePath)) {
+    fprintf(stderr, "Cannot write %s\n", opt.tracePath);
+    return 1;
+  }
+
+  if (opt.comparePath) {
+    std::vector<BaselineEntry> base;
+    if (!loadBaseline(opt.comparePath, base)) {
+      fprintf(stderr, "Cannot read baseline %s (run `make sim-bench-baseline` first)\n", opt.comparePath);
+      return 1;
+    }
+    int regressions = compareWithBaseline(base, results, opt.threshold);
+    if (regressions > 0) {
+      fprintf(stderr, "%d pattern(s) slower than baseline by more than %.0f%%\n", regressions, opt.threshold);
+      return 1;
+    }
+  }
+  return 0;
+}
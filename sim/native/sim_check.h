@@ -0,0 +1,19 @@
+#ifndef SIM_CHECK_H
+#define SIM_CHECK_H
+
+// Pass/fail bookkeeping for the check tools (sim-events, sim-realtime, sim-palette, ...):
+// check() reports a failed condition on stderr and counts it in `failures`; the tool
+// prints the count in its JSON line and exits 1 when it is not zero.
+
+#include <cstdio>
+
+inline int failures = 0;
+
+inline void check(bool cond, const char* what) {
+  if (!cond) {
+    fprintf(stderr, "FAIL: %s\n", what);
+    failures++;
+  }
+}
+
+#endif // SIM_CHECK_H
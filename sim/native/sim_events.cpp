@@ -0,0 +1,160 @@
+// Event stream check: drives EventStream (src/event_stream.h), the /events fan-out, with
+// fake connections whose TCP send window the test controls. Checks the connection cap,
+// the response head, delivery to every client, coalescing for a client that cannot keep
+// up (it gets the latest state, never a backlog), closing of stalled and disconnected
+// clients, keep-alives and refused events. Reports the fan-out's RAM and the cost of a
+// publish + poll. Exit status 1 on any failed check.
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+
+#include "event_stream.h"
+#include "sim_check.h"
+
+// Both ends of a connection; FakeClient copies share it, as WiFiClient copies share the
+// TCP connection
+struct Connection {
+  bool connected = true;
+  size_t window = 2920;  // bytes the send buffer takes before the reader drains it
+  std::string received;
+  bool stopped = false;
+};
+
+class FakeClient {
+ public:
+  FakeClient() {}
+  explicit FakeClient(std::shared_ptr<Connection> c) : conn_(c) {}
+  bool connected() const { return conn_ && conn_->connected && !conn_->stopped; }
+  int availableForWrite() const { return connected() ? static_cast<int>(conn_->window) : 0; }
+  size_t write(const uint8_t* data, size_t len) {
+    if (!connected()) return 0;
+    size_t n = len < conn_->window ? len : conn_->window;
+    conn_->received.append(reinterpret_cast<const char*>(data), n);
+    conn_->window -= n;
+    return n;
+  }
+  void stop() {
+    if (conn_) conn_->stopped = true;
+  }
+
+ private:
+  std::shared_ptr<Connection> conn_;
+};
+
+typedef EventStream<FakeClient> Stream;
+
+static size_t count(const std::string& s, const std::string& what) {
+  size_t n = 0;
+  for (size_t at = s.find(what); at != std::string::npos; at = s.find(what, at + 1)) n++;
+  return n;
+}
+
+static bool publish(Stream& events, const char* json) { return events.publish(json, strlen(json)); }
+
+static void runChecks() {
+  Stream events;
+  std::shared_ptr<Connection> conn[4];
+  for (int i = 0; i < 4; i++) conn[i] = std::make_shared<Connection>();
+
+  // Cap
+  for (int i = 0; i < 3; i++) check(events.add(FakeClient(conn[i]), 0), "add below the cap");
+  check(!events.add(FakeClient(conn[3]), 0), "add past the cap accepted");
+  check(events.clients() == 3 && events.stats().rejected == 1, "client count at the cap");
+  check(conn[3]->received.empty(), "refused client was written to");
+  check(conn[0]->received.compare(0, 15, "HTTP/1.1 200 OK") == 0 &&
+            conn[0]->received.find("Content-Type: text/event-stream\r\n") != std::string::npos &&
+            conn[0]->received.find("\r\n\r\nretry: 3000\n\n") != std::string::npos,
+        "response head");
+
+  // Every client gets the event once
+  for (int i = 0; i < 3; i++) conn[i]->received.clear();
+  publish(events, "{\"pattern\":1}");
+  events.poll(10);
+  events.poll(11);
+  for (int i = 0; i < 3; i++) check(conn[i]->received == "data: {\"pattern\":1}\n\n", "event delivered once");
+
+  // A client with a full send buffer skips to the latest event
+  for (int i = 0; i < 3; i++) conn[i]->received.clear();
+  conn[2]->window = 0;
+  publish(events, "{\"pattern\":2}");
+  events.poll(20);
+  publish(events, "{\"pattern\":3}");
+  events.poll(30);
+  publish(events, "{\"pattern\":4}");
+  events.poll(40);
+  check(count(conn[0]->received, "data: ") == 3, "fast client missed events");
+  check(conn[2]->received.empty(), "wrote into a full send buffer");
+  conn[2]->window = 6;  // room for part of an event only
+  events.poll(50);
+  check(conn[2]->received.empty(), "partial event written");
+  conn[2]->window = 2920;
+  events.poll(60);
+  check(conn[2]->received == "data: {\"pattern\":4}\n\n", "slow client did not get just the latest event");
+  check(events.stats().coalesced == 2, "coalesced count");
+
+  // A client that stops reading is closed after kStallMs; its slot is free again
+  conn[1]->window = 0;
+  publish(events, "{\"pattern\":5}");
+  events.poll(1000);
+  events.poll(1000 + Stream::kStallMs - 1);
+  check(events.clients() == 3, "closed before kStallMs");
+  events.poll(1000 + Stream::kStallMs);
+  check(events.clients() == 2 && events.stats().stalled == 1 && conn[1]->stopped, "stalled client kept");
+  conn[3]->received.clear();
+  check(events.add(FakeClient(conn[3]), 20000), "slot not reused");
+  events.poll(20001);
+  check(conn[3]->received.find("data: {\"pattern\":5}\n\n") != std::string::npos, "new client missed the current state");
+
+  // Disconnects are noticed
+  conn[0]->connected = false;
+  events.poll(20002);
+  check(events.clients() == 2 && conn[0]->stopped, "disconnected client kept");
+
+  // Keep-alive on an idle stream
+  conn[3]->received.clear();
+  events.poll(20001 + Stream::kKeepAliveMs - 1);
+  check(conn[3]->received.empty(), "keep-alive too early");
+  events.poll(20001 + Stream::kKeepAliveMs);
+  check(conn[3]->received == ":\n\n", "no keep-alive");
+
+  // Events that cannot be one SSE data line are refused
+  check(!publish(events, "{\"a\":1}\n{\"b\":2}"), "event with a newline accepted");
+  std::string big(Stream::kMaxEvent + 1, 'x');
+  check(!events.publish(big.data(), big.size()), "oversized event accepted");
+  check(events.publish(big.data(), Stream::kMaxEvent), "event of kMaxEvent bytes refused");
+}
+
+static double publishPollNs(int runs) {
+  Stream events;
+  std::shared_ptr<Connection> conn[3];
+  for (int i = 0; i < 3; i++) {
+    conn[i] = std::make_shared<Connection>();
+    events.add(FakeClient(conn[i]), 0);
+  }
+  const char* json = "{\"pattern\":114,\"leds\":1296,\"text\":\"HELLO WORLD\",\"speed\":50,\"bri\":64,"
+                     "\"realtime\":false,\"fps\":50,\"frames\":123456,\"missed\":12,\"heap\":23456,\"clients\":3}";
+  size_t len = strlen(json);
+  auto start = std::chrono::steady_clock::now();
+  for (int r = 0; r < runs; r++) {
+    events.publish(json, len);
+    events.poll(static_cast<unsigned long>(r));
+    for (int i = 0; i < 3; i++) {
+      conn[i]->received.clear();
+      conn[i]->window = 2920;
+    }
+  }
+  return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / runs;
+}
+
+int main() {
+  runChecks();
+  printf("{\"checks\": \"%s\", \"failures\": %d, \"max_clients\": 3, \"stream_bytes\": %zu, "
+         "\"publish_poll_ns\": %.0f}\n",
+         failures ? "failed" : "ok", failures, sizeof(EventStream<FakeClient>) - 3 * sizeof(FakeClient),
+         publishPollNs(100000));
+  return failures ? 1 : 0;
+}
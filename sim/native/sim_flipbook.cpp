@@ -0,0 +1,172 @@
+// Flipbook encode / decode bench: records a registry pattern on the simulator core
+// (sim/wasm/sim_core.cpp), encodes it as a flipbook (src/flipbook.h), then decodes it
+// through FlipbookPlayer's fixed read buffer and reports size and decode cost per frame.
+// Every decoded frame is checked against the recording, directly and by playing the file
+// as pattern 123 through sim_set_flipbook(). --out writes the file, which the device takes
+// as is:
+//
+//   curl --data-binary @lava.npfb -H 'Content-Type: application/octet-stream' http://<ip>/uploadFlipbook
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "flipbook.h"
+#include "frame_tracker.h"
+
+#include "../wasm/sim_core.h"
+
+static const int kFlipbookPattern = 123;
+
+struct Options {
+  int pattern = 114;
+  int frames = 500;
+  uint32_t deltaMs = 20;  // recording step, stored as every frame's duration
+  int keyEvery = 50;      // forced key frame interval, 0 = only where smaller than a delta
+  uint32_t seed = 12345;
+  int runs = 20;          // decode passes to time
+  const char* outPath = nullptr;
+};
+
+struct Buffer {
+  std::vector<uint8_t> data;
+  size_t pos = 0;
+};
+
+static int bufferRead(void* ctx, uint8_t* buf, int n) {
+  Buffer* b = static_cast<Buffer*>(ctx);
+  size_t take = std::min(static_cast<size_t>(n), b->data.size() - b->pos);
+  memcpy(buf, b->data.data() + b->pos, take);
+  b->pos += take;
+  return static_cast<int>(take);
+}
+
+static bool bufferSeek(void* ctx, uint32_t offset) {
+  Buffer* b = static_cast<Buffer*>(ctx);
+  if (offset > b->data.size()) return false;
+  b->pos = offset;
+  return true;
+}
+
+static uint32_t hashLeds(const CRGB* leds, int count) {
+  return FrameTracker::hash(reinterpret_cast<const uint8_t*>(leds), count * 3);
+}
+
+static void usage(const char* argv0) {
+  fprintf(stderr,
+          "Usage: %s [options]\n"
+          "  --pattern ID   pattern to record (default 114)\n"
+          "  --frames N     frames to record (default 500)\n"
+          "  --delta MS     ms per frame, stored as the frame duration (default 20)\n"
+          "  --key N        key frame at least every N frames, 0 = only where smaller (default 50)\n"
+          "  --seed S       sim_seed() value (default 12345)\n"
+          "  --runs N       timed decode passes (default 20)\n"
+          "  --out FILE     write the flipbook\n",
+          argv0);
+}
+
+int main(int argc, char** argv) {
+  Options opt;
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    bool hasValue = i + 1 < argc;
+    if (arg == "--pattern" && hasValue) opt.pattern = atoi(argv[++i]);
+    else if (arg == "--frames" && hasValue) opt.frames = atoi(argv[++i]);
+    else if (arg == "--delta" && hasValue) opt.deltaMs = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 0));
+    else if (arg == "--key" && hasValue) opt.keyEvery = atoi(argv[++i]);
+    else if (arg == "--seed" && hasValue) opt.seed = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 0));
+    else if (arg == "--runs" && hasValue) opt.runs = atoi(argv[++i]);
+    else if (arg == "--out" && hasValue) opt.outPath = argv[++i];
+    else {
+      usage(argv[0]);
+      return 2;
+    }
+  }
+  if (opt.frames <= 0 || opt.frames > 0xFFFF || opt.deltaMs == 0 || opt.deltaMs > 0xFFFF || opt.runs <= 0) {
+    usage(argv[0]);
+    return 2;
+  }
+
+  // Record and encode
+  sim_init(0, 0);
+  sim_set_pattern(opt.pattern);
+  sim_seed(opt.seed);
+  const int count = sim_get_buffer_length() / 3;
+  std::vector<CRGB> prev(count), cur(count);
+  std::vector<uint32_t> hashes;
+  std::vector<uint8_t> key(count * 4), delta(count * 4);
+  Buffer book;
+  book.data.resize(kFlipbookHeaderBytes);
+  flipbookWriteHeader(book.data.data(), count, opt.frames);
+  int keyFrames = 0;
+  for (int f = 0; f < opt.frames; f++) {
+    sim_step(opt.deltaMs);
+    memcpy(cur.data(), sim_get_buffer(), count * 3);
+    hashes.push_back(hashLeds(cur.data(), count));
+    size_t keyLen = flipbookEncodeKey(cur.data(), count, key.data(), key.size());
+    size_t deltaLen = f > 0 ? flipbookEncodeDelta(prev.data(), cur.data(), count, delta.data(), delta.size()) : 0;
+    bool isKey = f == 0 || (opt.keyEvery > 0 && f % opt.keyEvery == 0) || keyLen <= deltaLen;
+    const std::vector<uint8_t>& payload = isKey ? key : delta;
+    size_t len = isKey ? keyLen : deltaLen;
+    uint8_t h[kFlipbookFrameHeaderBytes];
+    flipbookWriteFrameHeader(h, isKey ? FLIPBOOK_KEY : FLIPBOOK_DELTA, opt.deltaMs, len);
+    book.data.insert(book.data.end(), h, h + sizeof(h));
+    book.data.insert(book.data.end(), payload.begin(), payload.begin() + len);
+    keyFrames += isKey;
+    std::swap(prev, cur);
+  }
+
+  // Decode through the player and check every frame
+  FlipbookPlayer player;
+  bool ok = player.open(bufferRead, bufferSeek, &book) && player.validate(book.data.size());
+  std::vector<CRGB> leds(count);
+  int mismatches = 0;
+  for (int f = 0; ok && f < opt.frames; f++) {
+    ok = player.nextFrame(leds.data(), count);
+    if (ok && hashLeds(leds.data(), count) != hashes[f]) mismatches++;
+  }
+
+  using clock = std::chrono::steady_clock;
+  auto start = clock::now();
+  for (int r = 0; ok && r < opt.runs; r++) {
+    player.restart();
+    for (int f = 0; ok && f < opt.frames; f++) ok = player.nextFrame(leds.data(), count);
+  }
+  double decodeNs = std::chrono::duration<double, std::nano>(clock::now() - start).count() /
+                    (static_cast<double>(opt.runs) * opt.frames);
+
+  // Play it as pattern 123: step k shows frame k
+  int playMismatches = 0;
+  if (ok && sim_set_flipbook(book.data.data(), static_cast<int>(book.data.size())) == opt.frames) {
+    sim_init(0, 0);
+    sim_set_pattern(kFlipbookPattern);
+    for (int f = 0; f < opt.frames; f++) {
+      sim_step(opt.deltaMs);
+      if (hashLeds(reinterpret_cast<const CRGB*>(sim_get_buffer()), count) != hashes[f]) playMismatches++;
+    }
+  } else {
+    ok = false;
+  }
+
+  double rawBytes = static_cast<double>(count) * 3 * opt.frames;
+  printf("{\"pattern\": %d, \"frames\": %d, \"leds\": %d, \"key_frames\": %d, \"bytes\": %zu, "
+         "\"bytes_per_frame\": %.1f, \"ratio_pct\": %.1f, \"decode_ns_per_frame\": %.1f, "
+         "\"read_buffer\": %d, \"mismatches\": %d, \"play_mismatches\": %d, \"ok\": %s}\n",
+         opt.pattern, opt.frames, count, keyFrames, book.data.size(),
+         static_cast<double>(book.data.size()) / opt.frames, 100.0 * book.data.size() / rawBytes, decodeNs,
+         FlipbookPlayer::kReadBuffer, mismatches, playMismatches, ok ? "true" : "false");
+
+  if (opt.outPath) {
+    FILE* f = fopen(opt.outPath, "wb");
+    if (!f || fwrite(book.data.data(), 1, book.data.size(), f) != book.data.size() || fclose(f) != 0) {
+      fprintf(stderr, "Cannot write %s\n", opt.outPath);
+      return 1;
+    }
+  }
+  return ok && mismatches == 0 && playMismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,344 @@
+// Golden-frame capture / check: runs every 2D pattern on the simulator core
+// (sim/wasm/sim_core.cpp) with a fixed seed and clock and records each frame's hash plus
+// every Nth frame in full. Optimizations that must not change the picture (LUTs, fixed
+// point, SIMD) are checked against such a capture, bit for bit.
+//
+// The same source builds natively (scripts/build_sim_native.sh golden) and for node
+// (scripts/build_sim_wasm.sh), so a native capture can be checked against the WASM core.
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "../wasm/sim_core.h"
+
+static const int kPattern2D = 0x01;  // PATTERN_2D in src/pattern_registry.h
+
+// File layout (little-endian uint32 throughout):
+//   header:  magic, version, frames, delta_ms, seed, key_every, width, height, frame_bytes, patterns
+//   pattern: id, hash[frames], then the RGB bytes of every key frame in order
+// Frame k is a key frame when k % key_every == key_every - 1, and the last frame always is.
+static const uint32_t kMagic = 0x444c4f47;  // "GOLD"
+static const uint32_t kVersion = 1;
+
+struct GoldenSettings {
+  uint32_t frames = 300;
+  uint32_t deltaMs = 20;
+  uint32_t seed = 12345;
+  uint32_t keyEvery = 60;
+  uint32_t width = 0;
+  uint32_t height = 0;
+  uint32_t frameBytes = 0;
+};
+
+struct GoldenPattern {
+  int id;
+  std::string name;
+  std::vector<uint32_t> hashes;
+  std::vector<uint8_t> keyframes;  // frameBytes per key frame
+};
+
+struct Golden {
+  GoldenSettings settings;
+  std::vector<GoldenPattern> patterns;
+};
+
+static bool isKeyframe(const GoldenSettings& s, uint32_t frame) {
+  return frame + 1 == s.frames || frame % s.keyEvery == s.keyEvery - 1;
+}
+
+// Position of `frame` among the key frames, -1 if it is not one
+static int keyframeSlot(const GoldenSettings& s, uint32_t frame) {
+  if (!isKeyframe(s, frame)) return -1;
+  return static_cast<int>(frame + 1 == s.frames && frame % s.keyEvery != s.keyEvery - 1
+                              ? frame / s.keyEvery
+                              : (frame + 1) / s.keyEvery - 1);
+}
+
+static const char* patternName(int id) {
+  for (int i = 0; i < sim_get_pattern_count(); i++) {
+    if (sim_get_pattern_id(i) == id) return sim_get_pattern_name(i);
+  }
+  return "?";
+}
+
+static Golden capture(GoldenSettings s, const std::vector<int>& only) {
+  Golden g;
+  s.width = sim_get_grid_width();
+  s.height = sim_get_grid_height();
+  s.frameBytes = sim_get_buffer_length();
+  g.settings = s;
+
+  std::vector<uint8_t> frames(static_cast<size_t>(s.frames) * s.frameBytes);
+  std::vector<SimFrameMeta> meta(s.frames);
+  for (int i = 0; i < sim_get_pattern_count(); i++) {
+    if (!(sim_get_pattern_flags(i) & kPattern2D)) continue;
+    int id = sim_get_pattern_id(i);
+    if (!only.empty() && std::find(only.begin(), only.end(), id) == only.end()) continue;
+
+    sim_init(s.width, s.height);
+    sim_seed(s.seed);
+    sim_set_pattern(id);
+    sim_step_n(s.frames, s.deltaMs, frames.data(), 0, meta.data());
+
+    GoldenPattern p;
+    p.id = id;
+    p.name = sim_get_pattern_name(i);
+    for (uint32_t k = 0; k < s.frames; k++) {
+      p.hashes.push_back(meta[k].hash);
+      if (isKeyframe(s, k)) {
+        const uint8_t* f = frames.data() + static_cast<size_t>(k) * s.frameBytes;
+        p.keyframes.insert(p.keyframes.end(), f, f + s.frameBytes);
+      }
+    }
+    g.patterns.push_back(std::move(p));
+  }
+  return g;
+}
+
+static void put32(FILE* f, uint32_t v) {
+  uint8_t b[4] = {(uint8_t)v, (uint8_t)(v >> 8), (uint8_t)(v >> 16), (uint8_t)(v >> 24)};
+  fwrite(b, 1, 4, f);
+}
+
+static bool get32(FILE* f, uint32_t& v) {
+  uint8_t b[4];
+  if (fread(b, 1, 4, f) != 4) return false;
+  v = b[0] | (b[1] << 8) | (b[2] << 16) | ((uint32_t)b[3] << 24);
+  return true;
+}
+
+static bool save(const char* path, const Golden& g) {
+  FILE* f = fopen(path, "wb");
+  if (!f) return false;
+  const GoldenSettings& s = g.settings;
+  for (uint32_t v : {kMagic, kVersion, s.frames, s.deltaMs, s.seed, s.keyEvery, s.width, s.height,
+                     s.frameBytes, static_cast<uint32_t>(g.patterns.size())}) {
+    put32(f, v);
+  }
+  for (const GoldenPattern& p : g.patterns) {
+    put32(f, static_cast<uint32_t>(p.id));
+    for (uint32_t h : p.hashes) put32(f, h);
+    fwrite(p.keyframes.data(), 1, p.keyframes.size(), f);
+  }
+  return fclose(f) == 0;
+}
+
+static bool load(const char* path, Golden& g) {
+  FILE* f = fopen(path, "rb");
+  if (!f) return false;
+  GoldenSettings& s = g.settings;
+  uint32_t magic = 0, version = 0, count = 0;
+  bool ok = get32(f, magic) && magic == kMagic && get32(f, version) && version == kVersion &&
+            get32(f, s.frames) && get32(f, s.deltaMs) && get32(f, s.seed) && get32(f, s.keyEvery) &&
+            get32(f, s.width) && get32(f, s.height) && get32(f, s.frameBytes) && get32(f, count) &&
+            s.frames > 0 && s.keyEvery > 0;
+  uint32_t keyframes = 0;
+  for (uint32_t k = 0; ok && k < s.frames; k++) keyframes += isKeyframe(s, k) ? 1 : 0;
+  for (uint32_t i = 0; ok && i < count; i++) {
+    GoldenPattern p;
+    uint32_t id = 0;
+    ok = get32(f, id);
+    p.id = static_cast<int>(id);
+    p.name = patternName(p.id);
+    p.hashes.resize(s.frames);
+    for (uint32_t k = 0; ok && k < s.frames; k++) ok = get32(f, p.hashes[k]);
+    p.keyframes.resize(static_cast<size_t>(keyframes) * s.frameBytes);
+    ok = ok && fread(p.keyframes.data(), 1, p.keyframes.size(), f) == p.keyframes.size();
+    g.patterns.push_back(std::move(p));
+  }
+  fclose(f);
+  return ok;
+}
+
+// Bounding box, in grid coordinates, of the pixels that differ between two frames.
+static void describeRegion(const uint8_t* want, const uint8_t* got, const GoldenSettings& s, char* out,
+                           size_t outLen) {
+  const uint16_t* map = sim_get_led_map();
+  int count = 0, minX = 0, maxX = 0, minY = 0, maxY = 0, firstX = -1, firstY = -1;
+  for (uint32_t y = 0; y < s.height; y++) {
+    for (uint32_t x = 0; x < s.width; x++) {
+      uint32_t at = map[y * s.width + x] * 3u;
+      if (at + 3 > s.frameBytes || memcmp(want + at, got + at, 3) == 0) continue;
+      if (count == 0) {
+        minX = maxX = firstX = x;
+        minY = maxY = firstY = y;
+      }
+      minX = std::min<int>(minX, x);
+      maxX = std::max<int>(maxX, x);
+      minY = std::min<int>(minY, y);
+      maxY = std::max<int>(maxY, y);
+      count++;
+    }
+  }
+  if (count == 0) {
+    snprintf(out, outLen, "no grid pixel differs");
+    return;
+  }
+  const uint8_t* w = want + map[firstY * s.width + firstX] * 3;
+  const uint8_t* g = got + map[firstY * s.width + firstX] * 3;
+  snprintf(out, outLen, "%d px in x %d..%d, y %d..%d; first (%d,%d) expected #%02x%02x%02x got #%02x%02x%02x",
+           count, minX, maxX, minY, maxY, firstX, firstY, w[0], w[1], w[2], g[0], g[1], g[2]);
+}
+
+// Prints one line per pattern; returns the number of patterns that differ.
+static int diff(const Golden& want, const Golden& got) {
+  const GoldenSettings& s = want.settings;
+  const GoldenSettings& t = got.settings;
+  if (s.frames != t.frames || s.deltaMs != t.deltaMs || s.seed != t.seed || s.keyEvery != t.keyEvery ||
+      s.width != t.width || s.height != t.height || s.frameBytes != t.frameBytes) {
+    fprintf(stderr, "Captures were made with different settings (frames/delta/seed/key frames/grid)\n");
+    return 1;
+  }
+
+  int failures = 0;
+  for (const GoldenPattern& w : want.patterns) {
+    const GoldenPattern* g = nullptr;
+    for (const GoldenPattern& p : got.patterns) {
+      if (p.id == w.id) { g = &p; break; }
+    }
+    if (!g) {
+      fprintf(stderr, "%-4d %-20s missing\n", w.id, w.name.c_str());
+      failures++;
+      continue;
+    }
+    uint32_t first = 0;
+    while (first < s.frames && w.hashes[first] == g->hashes[first]) first++;
+    if (first == s.frames) {
+      fprintf(stderr, "%-4d %-20s ok\n", w.id, w.name.c_str());
+      continue;
+    }
+    failures++;
+    uint32_t last = first, differing = 0;
+    for (uint32_t k = first; k < s.frames; k++) {
+      if (w.hashes[k] != g->hashes[k]) {
+        last = k;
+        differing++;
+      }
+    }
+
+    // Locate the difference on the first stored frame at or after it
+    char region[160] = "key frames identical";
+    uint32_t shown = s.frames;
+    for (uint32_t k = first; k < s.frames; k++) {
+      int slot = keyframeSlot(s, k);
+      if (slot < 0) continue;
+      const uint8_t* a = w.keyframes.data() + static_cast<size_t>(slot) * s.frameBytes;
+      const uint8_t* b = g->keyframes.data() + static_cast<size_t>(slot) * s.frameBytes;
+      if (memcmp(a, b, s.frameBytes) == 0) continue;
+      describeRegion(a, b, s, region, sizeof(region));
+      shown = k;
+      break;
+    }
+    if (shown < s.frames) {
+      fprintf(stderr, "%-4d %-20s DIFFERS in %u frame(s), %u..%u; frame %u: %s\n", w.id, w.name.c_str(),
+              differing, first, last, shown, region);
+    } else {
+      fprintf(stderr, "%-4d %-20s DIFFERS in %u frame(s), %u..%u; %s\n", w.id, w.name.c_str(), differing,
+              first, last, region);
+    }
+  }
+  for (const GoldenPattern& g : got.patterns) {
+    bool known = false;
+    for (const GoldenPattern& w : want.patterns) known = known || w.id == g.id;
+    if (!known) fprintf(stderr, "%-4d %-20s new (not in golden file)\n", g.id, g.name.c_str());
+  }
+  return failures;
+}
+
+static void usage(const char* argv0) {
+  fprintf(stderr,
+          "Usage: %s --capture FILE [options]   record golden frames\n"
+          "       %s --check FILE [--pattern ID]  re-render and compare against FILE\n"
+          "       %s --diff WANT GOT              compare two captures (e.g. native vs WASM)\n"
+          "  --frames N        frames per pattern (default 300)\n"
+          "  --delta MS        simulated ms per frame (default 20)\n"
+          "  --seed S          sim_seed() value applied before each pattern (default 12345)\n"
+          "  --keyframe N      store every Nth frame in full (default 60, the last frame always)\n"
+          "  --pattern ID      only this pattern (repeatable)\n",
+          argv0, argv0, argv0);
+}
+
+int main(int argc, char** argv) {
+  GoldenSettings settings;
+  std::vector<int> only;
+  const char* capturePath = nullptr;
+  const char* checkPath = nullptr;
+  const char* diffPaths[2] = {nullptr, nullptr};
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    bool hasValue = i + 1 < argc;
+    if (arg == "--capture" && hasValue) {
+      capturePath = argv[++i];
+    } else if (arg == "--check" && hasValue) {
+      checkPath = argv[++i];
+    } else if (arg == "--diff" && i + 2 < argc) {
+      diffPaths[0] = argv[++i];
+      diffPaths[1] = argv[++i];
+    } else if (arg == "--frames" && hasValue) {
+      settings.frames = static_cast<uint32_t>(std::max(1, atoi(argv[++i])));
+    } else if (arg == "--delta" && hasValue) {
+      settings.deltaMs = static_cast<uint32_t>(std::max(1, atoi(argv[++i])));
+    } else if (arg == "--seed" && hasValue) {
+      settings.seed = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 0));
+    } else if (arg == "--keyframe" && hasValue) {
+      settings.keyEvery = static_cast<uint32_t>(std::max(1, atoi(argv[++i])));
+    } else if (arg == "--pattern" && hasValue) {
+      only.push_back(atoi(argv[++i]));
+    } else {
+      usage(argv[0]);
+      return 2;
+    }
+  }
+
+  if (capturePath) {
+    Golden g = capture(settings, only);
+    if (!save(capturePath, g)) {
+      fprintf(stderr, "Cannot write %s\n", capturePath);
+      return 1;
+    }
+    fprintf(stderr, "Captured %zu pattern(s) x %u frames to %s\n", g.patterns.size(), settings.frames,
+            capturePath);
+    return 0;
+  }
+
+  Golden want, got;
+  if (checkPath) {
+    if (!load(checkPath, want)) {
+      fprintf(stderr, "Cannot read golden file %s (run `make sim-golden-capture` first)\n", checkPath);
+      return 1;
+    }
+    // Re-render with the settings the file was captured with
+    if (!only.empty()) {
+      std::vector<GoldenPattern> kept;
+      for (GoldenPattern& p : want.patterns) {
+        if (std::find(only.begin(), only.end(), p.id) != only.end()) kept.push_back(std::move(p));
+      }
+      want.patterns.swap(kept);
+    } else {
+      for (const GoldenPattern& p : want.patterns) only.push_back(p.id);
+    }
+    got = capture(want.settings, only);
+  } else if (diffPaths[0]) {
+    for (int i = 0; i < 2; i++) {
+      if (!load(diffPaths[i], i == 0 ? want : got)) {
+        fprintf(stderr, "Cannot read golden file %s\n", diffPaths[i]);
+        return 1;
+      }
+    }
+  } else {
+    usage(argv[0]);
+    return 2;
+  }
+
+  int failures = diff(want, got);
+  if (failures > 0) {
+    fprintf(stderr, "%d pattern(s) differ from the golden frames\n", failures);
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,100 @@
+// Palette check: PaletteEngine (src/palette.h), the color schemes patterns read instead of
+// CHSV. Checks that scheme 0 reproduces CHSV(h, 255, v) for every hue and value, that the
+// 16-color schemes hit their colors at every 16th entry and wrap, that switching blends
+// over kBlendMs instead of jumping, and that unknown ids are refused. Times a full panel
+// of CHSV conversions against table lookups. Exit status 1 on any failed check.
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#include "palette.h"
+#include "sim_check.h"
+
+static bool same(const CRGB& a, const CRGB& b) { return a.r == b.r && a.g == b.g && a.b == b.b; }
+
+static bool sameTable(const CRGB* a, const CRGB* b) {
+  for (int i = 0; i < 256; i++) {
+    if (!same(a[i], b[i])) return false;
+  }
+  return true;
+}
+
+static void runChecks() {
+  PaletteEngine palettes;
+
+  // Scheme 0 is the HSV rainbow, bit for bit
+  bool rainbow = true;
+  for (int h = 0; h < 256 && rainbow; h++) {
+    for (int v = 0; v < 256 && rainbow; v++) {
+      rainbow = same(paletteColor(palettes.lut(), h, v), CRGB(CHSV(h, 255, v)));
+    }
+  }
+  check(rainbow, "scheme 0 differs from CHSV");
+  check(palettes.selected() == 0 && !palettes.blending(), "initial scheme");
+
+  // Names and ids
+  check(PaletteEngine::count() == 7, "scheme count");
+  check(strcmp(PaletteEngine::name(0), "Rainbow") == 0 && strcmp(PaletteEngine::name(6), "Heat") == 0, "names");
+  check(PaletteEngine::name(-1) == nullptr && PaletteEngine::name(7) == nullptr, "name of an unknown id");
+  check(!palettes.select(7) && !palettes.select(-1) && palettes.selected() == 0, "unknown id accepted");
+
+  // Heat: black at 0, red at 80, white at 240, and 255 blends back towards black
+  palettes.select(6, false);
+  const CRGB* lut = palettes.lut();
+  check(same(lut[0], CRGB(0, 0, 0)) && same(lut[80], CRGB(255, 0, 0)) && same(lut[240], CRGB(255, 255, 255)),
+        "entries at every 16th index");
+  check(lut[248].r < 255 && lut[248].r > 0 && lut[255].r < lut[248].r, "wrap from the last entry to the first");
+  check(lut[8].r > lut[0].r && lut[8].r < lut[16].r, "blend between neighbours");
+
+  // Switching blends from the old table to the new one over kBlendMs
+  CRGB heat[256];
+  memcpy(heat, palettes.lut(), sizeof(heat));
+  PaletteEngine rainbowOnly;
+  palettes.update(1000);
+  check(palettes.select(0), "select");
+  check(palettes.blending() && sameTable(palettes.lut(), heat), "select jumped to the new table");
+  palettes.update(1000 + PaletteEngine::kBlendMs / 4);
+  check(palettes.blending() && !sameTable(palettes.lut(), heat) && !sameTable(palettes.lut(), rainbowOnly.lut()),
+        "no partial blend after a quarter of kBlendMs");
+  palettes.update(1000 + PaletteEngine::kBlendMs + 1);
+  check(!palettes.blending() && sameTable(palettes.lut(), rainbowOnly.lut()), "blend not done after kBlendMs");
+
+  // Frames closer together than a step still move
+  palettes.select(1);
+  memcpy(heat, palettes.lut(), sizeof(heat));
+  palettes.update(1000 + PaletteEngine::kBlendMs + 1);
+  check(!sameTable(palettes.lut(), heat), "no progress at 0 ms between frames");
+}
+
+static volatile uint32_t sink;
+
+// Mean ns to color a 1296-LED panel: CHSV per pixel or a palette lookup per pixel
+static double panelNs(bool lookup, int runs) {
+  PaletteEngine palettes;
+  const CRGB* lut = palettes.lut();
+  static CRGB leds[1296];
+  auto start = std::chrono::steady_clock::now();
+  for (int r = 0; r < runs; r++) {
+    uint8_t hue = (uint8_t)r;
+    for (int i = 0; i < 1296; i++) {
+      uint8_t h = hue + (uint8_t)(i * 7);
+      uint8_t v = (uint8_t)(i * 3 + r);
+      leds[i] = lookup ? paletteColor(lut, h, v) : CRGB(CHSV(h, 255, v));
+    }
+    sink = sink + leds[r % 1296].r;
+  }
+  return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / runs;
+}
+
+int main() {
+  runChecks();
+  double chsvNs = panelNs(false, 2000);
+  double lutNs = panelNs(true, 2000);
+  printf("{\"checks\": \"%s\", \"failures\": %d, \"schemes\": %d, \"engine_bytes\": %zu, "
+         "\"chsv_panel_ns\": %.0f, \"lut_panel_ns\": %.0f, \"speedup\": %.1f}\n",
+         failures ? "failed" : "ok", failures, PaletteEngine::count(), sizeof(PaletteEngine), chsvNs, lutNs,
+         chsvNs / lutNs);
+  return failures ? 1 : 0;
+}
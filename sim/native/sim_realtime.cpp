@@ -0,0 +1,359 @@
+// Realtime receiver check / bench: builds E1.31 and DDP packets the way a show controller
+// sends them, feeds them to RealtimeReceiver (src/realtime_receiver.h) and checks every LED
+// lands where the mapping puts it - E1.31 with and without sync, DDP with push, grid and
+// strip mapping - plus stale sequence numbers, preview data, stream termination and the
+// timeout. Then reports packets per second, parse only (packets from memory) and over a
+// loopback UDP socket (sendto / recv on 127.0.0.1, one frame's packets per batch).
+//
+// Exit status 1 on any failed check; the loopback figure is skipped if no socket can be
+// opened.
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "realtime_receiver.h"
+#include "sim_check.h"
+
+typedef std::vector<uint8_t> Packet;
+
+// What WiFiUDP offers the receiver: read() from the current packet
+struct PacketSource {
+  const uint8_t* data;
+  size_t len;
+  size_t pos;
+
+  PacketSource(const uint8_t* d, size_t n) : data(d), len(n), pos(0) {}
+  int read(uint8_t* buf, size_t n) {
+    size_t take = std::min(n, len - pos);
+    memcpy(buf, data + pos, take);
+    pos += take;
+    return static_cast<int>(take);
+  }
+};
+
+// --- packet builders -------------------------------------------------------------------
+
+static void put16(uint8_t* p, uint32_t v) {
+  p[0] = (v >> 8) & 0xFF;
+  p[1] = v & 0xFF;
+}
+
+static void put32(uint8_t* p, uint32_t v) {
+  put16(p, v >> 16);
+  put16(p + 2, v & 0xFFFF);
+}
+
+static void e131Root(uint8_t* p, uint32_t vector, int len) {
+  static const uint8_t kId[12] = { 'A', 'S', 'C', '-', 'E', '1', '.', '1', '7', 0, 0, 0 };
+  put16(p, 0x0010);
+  memcpy(p + 4, kId, sizeof(kId));
+  put16(p + 16, 0x7000 | (len - 16));
+  put32(p + 18, vector);
+  memset(p + 22, 0xA5, 16);  // CID
+}
+
+static Packet e131Data(uint16_t universe, uint8_t seq, uint16_t syncAddress, const uint8_t* channels, int n,
+                       uint8_t options = 0) {
+  Packet p(RealtimeReceiver::kE131HeaderBytes + n);
+  e131Root(p.data(), 0x04, static_cast<int>(p.size()));
+  put16(&p[38], 0x7000 | (p.size() - 38));
+  put32(&p[40], 0x02);
+  snprintf(reinterpret_cast<char*>(&p[44]), 64, "sim-realtime");
+  p[108] = 100;  // priority
+  put16(&p[109], syncAddress);
+  p[111] = seq;
+  p[112] = options;
+  put16(&p[113], universe);
+  put16(&p[115], 0x7000 | (p.size() - 115));
+  p[117] = 0x02;
+  p[118] = 0xA1;
+  put16(&p[121], 1);
+  put16(&p[123], n + 1);
+  memcpy(&p[126], channels, n);
+  return p;
+}
+
+static Packet e131Sync(uint16_t address, uint8_t seq) {
+  Packet p(RealtimeReceiver::kE131SyncBytes);
+  e131Root(p.data(), 0x08, static_cast<int>(p.size()));
+  put16(&p[38], 0x7000 | (p.size() - 38));
+  put32(&p[40], 0x01);
+  p[44] = seq;
+  put16(&p[45], address);
+  return p;
+}
+
+static Packet ddpData(uint8_t seq, uint32_t offset, const uint8_t* channels, int n, bool push) {
+  Packet p(10 + n);
+  p[0] = 0x40 | (push ? 0x01 : 0);
+  p[1] = seq & 0x0F;
+  p[2] = 0x0B;  // RGB, 8 bit
+  p[3] = 1;
+  put32(&p[4], offset);
+  put16(&p[8], n);
+  memcpy(&p[10], channels, n);
+  return p;
+}
+
+// One frame of `channels` as E1.31 universes from 1 on (sync packet last if syncAddress)
+static std::vector<Packet> e131Frame(const std::vector<uint8_t>& channels, uint8_t seq, uint16_t syncAddress) {
+  std::vector<Packet> out;
+  const int per = 510;
+  for (size_t off = 0, u = 1; off < channels.size(); off += per, u++) {
+    int n = static_cast<int>(std::min<size_t>(per, channels.size() - off));
+    out.push_back(e131Data(static_cast<uint16_t>(u), seq, syncAddress, channels.data() + off, n));
+  }
+  if (syncAddress) out.push_back(e131Sync(syncAddress, seq));
+  return out;
+}
+
+// DDP sequence numbers count packets 1..15 (0 would mean unused)
+static uint8_t nextDdpSeq(uint8_t& seq) {
+  seq = seq % 15 + 1;
+  return seq;
+}
+
+// One frame as DDP packets of 1440 channels (480 LEDs), push on the last
+static std::vector<Packet> ddpFrame(const std::vector<uint8_t>& channels, uint8_t& seq) {
+  std::vector<Packet> out;
+  const size_t per = 1440;
+  for (size_t off = 0; off < channels.size(); off += per) {
+    int n = static_cast<int>(std::min(per, channels.size() - off));
+    out.push_back(ddpData(nextDdpSeq(seq), static_cast<uint32_t>(off), channels.data() + off, n,
+                          off + per >= channels.size()));
+  }
+  return out;
+}
+
+enum Proto { E131, DDP };
+
+static bool feed(RealtimeReceiver& rx, Proto proto, const Packet& p, unsigned long now) {
+  PacketSource src(p.data(), p.size());
+  int len = static_cast<int>(p.size());
+  return proto == E131 ? rx.receiveE131(src, len, now) : rx.receiveDdp(src, len, now);
+}
+
+// --- checks ----------------------------------------------------------------------------
+
+static const int kLeds = MAX_LEDS;
+static CRGB leds[MAX_LEDS];
+
+static std::vector<uint8_t> randomChannels(uint32_t seed) {
+  std::vector<uint8_t> c(kLeds * 3);
+  for (uint8_t& v : c) {
+    seed = seed * 1103515245u + 12345u;
+    v = static_cast<uint8_t>(seed >> 16);
+  }
+  return c;
+}
+
+// Controller pixel p is where the mapping says
+static bool placed(const std::vector<uint8_t>& channels, RealtimeReceiver::Mapping map) {
+  for (int p = 0; p < kLeds; p++) {
+    int led = map == RealtimeReceiver::MAP_GRID && p < GRID_LEDS ? xyRow(p / GRID_WIDTH)[p % GRID_WIDTH] : p;
+    if (leds[led].r != channels[p * 3] || leds[led].g != channels[p * 3 + 1] || leds[led].b != channels[p * 3 + 2]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static void checkFrames(const char* name, Proto proto, RealtimeReceiver::Mapping map, uint16_t syncAddress) {
+  RealtimeReceiver rx;
+  rx.begin(leds, kLeds);
+  rx.configure(1, map, 2500);
+  std::string what;
+  uint8_t ddpSeq = 0;
+  for (int f = 0; f < 3; f++) {
+    std::vector<uint8_t> channels = randomChannels(f * 7 + 1);
+    uint8_t seq = static_cast<uint8_t>(f + 1);
+    std::vector<Packet> packets = proto == E131 ? e131Frame(channels, seq, syncAddress) : ddpFrame(channels, ddpSeq);
+    bool early = false;
+    for (size_t i = 0; i < packets.size(); i++) {
+      feed(rx, proto, packets[i], 1000 + f * 20);
+      if (i + 1 < packets.size()) early |= rx.takeFrame();
+    }
+    what = std::string(name) + ": frame completed before its last packet";
+    check(!early, what.c_str());
+    what = std::string(name) + ": frame not completed";
+    check(rx.takeFrame(), what.c_str());
+    what = std::string(name) + ": LEDs do not match the mapping";
+    check(placed(channels, map), what.c_str());
+  }
+  what = std::string(name) + ": counters";
+  check(rx.stats().frames == 3 && rx.stats().dropped == 0 && rx.stats().outOfOrder == 0 &&
+            rx.stats().syncs == (syncAddress ? 3u : 0u),
+        what.c_str());
+}
+
+static void checkEdges() {
+  RealtimeReceiver rx;
+  rx.begin(leds, kLeds);
+  rx.configure(1, RealtimeReceiver::MAP_STRIP, 2500);
+  std::vector<uint8_t> a = randomChannels(11), b = randomChannels(12);
+
+  // Stale and repeated E1.31 sequence numbers are dropped, a wrap is not
+  feed(rx, E131, e131Data(1, 10, 0, a.data(), 510), 0);
+  check(!feed(rx, E131, e131Data(1, 10, 0, b.data(), 510), 0), "e131: repeated sequence written");
+  check(!feed(rx, E131, e131Data(1, 5, 0, b.data(), 510), 0), "e131: stale sequence written");
+  check(leds[0].r == a[0] && leds[169].b == a[509], "e131: stale packet changed LEDs");
+  check(feed(rx, E131, e131Data(1, 200, 0, b.data(), 510), 0), "e131: sequence jump refused");
+  check(feed(rx, E131, e131Data(1, 3, 0, a.data(), 510), 0), "e131: sequence wrap refused");
+  check(rx.stats().outOfOrder == 2, "e131: out-of-order count");
+
+  // Foreign universes and preview data are not shown
+  check(!feed(rx, E131, e131Data(40, 4, 0, b.data(), 510), 0), "e131: universe past the chain written");
+  check(!feed(rx, E131, e131Data(1, 4, 0, b.data(), 510, 0x40), 0), "e131: preview data written");
+  check(rx.stats().dropped == 2, "e131: dropped count");
+
+  // Short and non-E1.31 packets
+  Packet junk(200, 0x55);
+  check(!feed(rx, E131, junk, 0), "e131: junk accepted");
+  check(!feed(rx, DDP, Packet(6, 0x41), 0), "ddp: short packet accepted");
+
+  // Timeout and stream termination
+  check(rx.active(2499) && !rx.active(2500), "timeout");
+  feed(rx, E131, e131Data(1, 5, 0, a.data(), 510), 3000);
+  check(rx.active(3001), "active again after a packet");
+  feed(rx, E131, e131Data(1, 6, 0, a.data(), 510, 0x20), 3002);
+  check(!rx.active(3003), "stream termination");
+
+  // A sync for another address does not release the frame
+  rx.configure(1, RealtimeReceiver::MAP_STRIP, 2500);
+  for (const Packet& p : e131Frame(a, 1, 7000)) {
+    if (p.size() == static_cast<size_t>(RealtimeReceiver::kE131SyncBytes)) feed(rx, E131, e131Sync(7001, 1), 0);
+    else feed(rx, E131, p, 0);
+  }
+  check(!rx.takeFrame(), "e131: sync for another address released the frame");
+  feed(rx, E131, e131Sync(7000, 2), 0);
+  check(rx.takeFrame(), "e131: sync did not release the frame");
+
+  // Repeated DDP sequence numbers; a shorter chain ignores what is past it
+  rx.configure(1, RealtimeReceiver::MAP_GRID, 2500);
+  rx.setLedCount(100);
+  leds[100] = CRGB(1, 2, 3);
+  check(feed(rx, DDP, ddpData(3, 0, a.data(), 1440, true), 0), "ddp: packet refused");
+  check(!feed(rx, DDP, ddpData(3, 0, b.data(), 1440, true), 0), "ddp: repeated sequence written");
+  check(leds[100].r == 1 && leds[100].g == 2 && leds[100].b == 3, "ddp: wrote past the LED count");
+  check(rx.stats().outOfOrder == 1 && rx.takeFrame(), "ddp: counters");
+}
+
+// --- benchmarks ------------------------------------------------------------------------
+
+static double parsePacketsPerSec(Proto proto, std::vector<Packet>& frame, int runs) {
+  RealtimeReceiver rx;
+  rx.begin(leds, kLeds);
+  uint8_t ddpSeq = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int r = 0; r < runs; r++) {
+    for (Packet& q : frame) {
+      // Fresh sequence numbers: per universe and frame for E1.31 (byte 111), per packet for DDP (byte 1)
+      if (proto == E131 && q.size() > 111) q[111] = static_cast<uint8_t>(r);
+      if (proto == DDP) q[1] = nextDdpSeq(ddpSeq);
+      feed(rx, proto, q, 0);
+    }
+  }
+  double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  return frame.size() * static_cast<double>(runs) / secs;
+}
+
+// Sends each frame's packets to a loopback socket and drains them into the receiver.
+// Returns packets/s, or a negative value if sockets are not available.
+static double loopbackPacketsPerSec(Proto proto, std::vector<Packet>& frame, int runs, uint32_t& frames) {
+  int rxSock = socket(AF_INET, SOCK_DGRAM, 0);
+  int txSock = socket(AF_INET, SOCK_DGRAM, 0);
+  sockaddr_in addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  addr.sin_port = 0;  // any free port, not the real 5568 / 4048
+  socklen_t addrLen = sizeof(addr);
+  int bufBytes = 1 << 20;
+  if (rxSock < 0 || txSock < 0 || bind(rxSock, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 ||
+      getsockname(rxSock, reinterpret_cast<sockaddr*>(&addr), &addrLen) != 0) {
+    if (rxSock >= 0) close(rxSock);
+    if (txSock >= 0) close(txSock);
+    return -1;
+  }
+  setsockopt(rxSock, SOL_SOCKET, SO_RCVBUF, &bufBytes, sizeof(bufBytes));
+  timeval timeout = { 1, 0 };
+  setsockopt(rxSock, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+  RealtimeReceiver rx;
+  rx.begin(leds, kLeds);
+  uint8_t buf[1500];
+  uint8_t ddpSeq = 0;
+  size_t received = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int r = 0; r < runs; r++) {
+    for (Packet& q : frame) {
+      if (proto == E131 && q.size() > 111) q[111] = static_cast<uint8_t>(r);
+      if (proto == DDP) q[1] = nextDdpSeq(ddpSeq);
+      sendto(txSock, q.data(), q.size(), 0, reinterpret_cast<sockaddr*>(&addr), sizeof(addr));
+    }
+    for (size_t i = 0; i < frame.size(); i++) {
+      ssize_t n = recv(rxSock, buf, sizeof(buf), 0);
+      if (n <= 0) break;
+      received++;
+      PacketSource src(buf, static_cast<size_t>(n));
+      if (proto == E131) rx.receiveE131(src, static_cast<int>(n), 0);
+      else rx.receiveDdp(src, static_cast<int>(n), 0);
+    }
+  }
+  double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  close(rxSock);
+  close(txSock);
+  frames = rx.stats().frames;
+  return received / secs;
+}
+
+int main(int argc, char** argv) {
+  int runs = argc > 1 ? atoi(argv[1]) : 2000;
+  if (runs <= 0) runs = 2000;
+
+  checkFrames("e131 grid", E131, RealtimeReceiver::MAP_GRID, 0);
+  checkFrames("e131 strip", E131, RealtimeReceiver::MAP_STRIP, 0);
+  checkFrames("e131 sync grid", E131, RealtimeReceiver::MAP_GRID, 1);
+  checkFrames("ddp grid", DDP, RealtimeReceiver::MAP_GRID, 0);
+  checkFrames("ddp strip", DDP, RealtimeReceiver::MAP_STRIP, 0);
+  checkEdges();
+  printf("{\"checks\": \"%s\", \"failures\": %d, \"receiver_bytes\": %zu}\n", failures ? "failed" : "ok", failures,
+         sizeof(RealtimeReceiver));
+
+  std::vector<uint8_t> channels = randomChannels(99);
+  uint8_t ddpSeq = 0;
+  struct {
+    const char* name;
+    Proto proto;
+    std::vector<Packet> frame;
+  } benches[] = {
+      {"e131", E131, e131Frame(channels, 1, 0)},
+      {"ddp", DDP, ddpFrame(channels, ddpSeq)},
+  };
+  for (auto& b : benches) {
+    double parse = parsePacketsPerSec(b.proto, b.frame, runs);
+    uint32_t frames = 0;
+    double loopback = loopbackPacketsPerSec(b.proto, b.frame, runs, frames);
+    printf("{\"protocol\": \"%s\", \"leds\": %d, \"packets_per_frame\": %zu, \"parse_packets_s\": %.0f, "
+           "\"parse_fps\": %.0f, ",
+           b.name, kLeds, b.frame.size(), parse, parse / b.frame.size());
+    if (loopback < 0) {
+      printf("\"loopback\": \"unavailable\"}\n");
+    } else {
+      printf("\"loopback_packets_s\": %.0f, \"loopback_fps\": %.0f, \"loopback_frames\": %u}\n", loopback,
+             loopback / b.frame.size(), frames);
+    }
+  }
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,175 @@
+// SIMD kernel check: compares the framebuffer kernels of src/sim_simd.h (scale8_bytes,
+// qadd8_bytes, fill3_bytes) and the helpers built on them (fadeToBlackBy, blur1d in
+// src/platform.h) with plain scalar versions written from FastLED's own code. Every length
+// from 0 to a few vectors, at every start offset, so the vector bodies, the tails and
+// unaligned buffers are all covered; bytes next to the run must stay untouched. Build it
+// once per path (SIM_SIMD=0, the default SSE2, SIM_SIMD=avx2); `make sim-simd-check` runs
+// all three. Reports the path and the cost of a 1500-LED fade. Exit status 1 on any failed
+// check.
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "platform.h"
+#include "sim_check.h"
+
+#if SIM_SIMD_AVX2
+static const char* kPath = "avx2";
+#elif SIM_SIMD_SSE2
+static const char* kPath = "sse2";
+#elif SIM_SIMD_WASM
+static const char* kPath = "simd128";
+#else
+static const char* kPath = "scalar";
+#endif
+
+static const int kMaxLen = 200;  // bytes: several AVX2 vectors plus every tail length
+static const int kGuard = 8;     // bytes checked on each side of the run
+static int cases = 0;
+
+static uint32_t rngState = 12345;
+
+static uint8_t nextByte() {
+  rngState = rngState * 1103515245u + 12345u;
+  return (uint8_t)(rngState >> 16);
+}
+
+static void randomize(uint8_t* p, int n) {
+  for (int i = 0; i < n; i++) p[i] = nextByte();
+}
+
+// --- scalar references ------------------------------------------------------------------
+
+static void refScale8(uint8_t* p, int n, uint8_t scale) {
+  for (int i = 0; i < n; i++) p[i] = scale8(p[i], scale);
+}
+
+static void refQadd8(uint8_t* dst, const uint8_t* src, int n) {
+  for (int i = 0; i < n; i++) dst[i] = qadd8(dst[i], src[i]);
+}
+
+static void refFill3(uint8_t* p, int count, uint8_t a, uint8_t b, uint8_t c) {
+  for (int i = 0; i < count; i++) {
+    p[3 * i] = a;
+    p[3 * i + 1] = b;
+    p[3 * i + 2] = c;
+  }
+}
+
+// FastLED's blur1d: the carry loop the simulator's whole-buffer version replaces
+static void refBlur1d(CRGB* leds, int numLeds, uint8_t amount) {
+  uint8_t keep = 255 - amount;
+  uint8_t seep = amount >> 1;
+  CRGB carryover = CRGB::Black;
+  for (int i = 0; i < numLeds; i++) {
+    CRGB cur = leds[i];
+    CRGB part = CRGB(scale8(cur.r, seep), scale8(cur.g, seep), scale8(cur.b, seep));
+    cur = CRGB(qadd8(scale8(cur.r, keep), carryover.r), qadd8(scale8(cur.g, keep), carryover.g),
+               qadd8(scale8(cur.b, keep), carryover.b));
+    if (i) {
+      leds[i - 1] = CRGB(qadd8(leds[i - 1].r, part.r), qadd8(leds[i - 1].g, part.g), qadd8(leds[i - 1].b, part.b));
+    }
+    leds[i] = cur;
+    carryover = part;
+  }
+}
+
+// --- checks -----------------------------------------------------------------------------
+
+// Runs `kernel` and `reference` on identical random buffers of kGuard + offset + n + kGuard
+// bytes and compares all of them, guards included
+template <typename Kernel, typename Reference>
+static bool sameBytes(int n, int offset, Kernel kernel, Reference reference) {
+  const int size = kGuard + offset + n + kGuard;
+  std::vector<uint8_t> a(size), b(size), src(size);
+  randomize(a.data(), size);
+  randomize(src.data(), size);
+  b = a;
+  kernel(a.data() + kGuard + offset, src.data() + kGuard + offset);
+  reference(b.data() + kGuard + offset, src.data() + kGuard + offset);
+  cases++;
+  return a == b;
+}
+
+static void checkKernels() {
+  static const uint8_t kScales[] = { 0, 1, 2, 127, 128, 200, 254, 255 };
+  bool scaleOk = true, addOk = true, fillOk = true, fadeOk = true;
+  for (int n = 0; n <= kMaxLen; n++) {
+    for (int offset = 0; offset < 4; offset++) {
+      for (uint8_t scale : kScales) {
+        scaleOk &= sameBytes(n, offset, [&](uint8_t* p, const uint8_t*) { scale8_bytes(p, n, scale); },
+                             [&](uint8_t* p, const uint8_t*) { refScale8(p, n, scale); });
+      }
+      addOk &= sameBytes(n, offset, [&](uint8_t* p, const uint8_t* s) { qadd8_bytes(p, s, n); },
+                         [&](uint8_t* p, const uint8_t* s) { refQadd8(p, s, n); });
+      int count = n / 3;
+      uint8_t r = nextByte(), g = nextByte(), b = nextByte();
+      fillOk &= sameBytes(n, offset, [&](uint8_t* p, const uint8_t*) { fill3_bytes(p, count, r, g, b); },
+                          [&](uint8_t* p, const uint8_t*) { refFill3(p, count, r, g, b); });
+      uint8_t amount = nextByte();
+      fadeOk &= sameBytes(n, offset,
+                          [&](uint8_t* p, const uint8_t*) { fadeToBlackBy(reinterpret_cast<CRGB*>(p), count, amount); },
+                          [&](uint8_t* p, const uint8_t*) { refScale8(p, count * 3, 255 - amount); });
+    }
+  }
+  check(scaleOk, "scale8_bytes differs from scale8");
+  check(addOk, "qadd8_bytes differs from qadd8");
+  check(fillOk, "fill3_bytes differs from a pixel loop");
+  check(fadeOk, "fadeToBlackBy differs from scale8 per channel");
+
+  // The whole scale range on one length with a tail on every path
+  bool allScales = true;
+  for (int scale = 0; scale < 256; scale++) {
+    allScales &= sameBytes(kMaxLen - 1, 1, [&](uint8_t* p, const uint8_t*) { scale8_bytes(p, kMaxLen - 1, scale); },
+                           [&](uint8_t* p, const uint8_t*) { refScale8(p, kMaxLen - 1, scale); });
+  }
+  check(allScales, "scale8_bytes differs for some scale");
+
+  bool blurOk = true;
+  static const uint8_t kAmounts[] = { 0, 1, 64, 127, 128, 172, 254, 255 };
+  for (int leds = 0; leds <= kMaxLen / 3; leds++) {
+    for (uint8_t amount : kAmounts) {
+      blurOk &= sameBytes(leds * 3, leds % 4,
+                          [&](uint8_t* p, const uint8_t*) { blur1d(reinterpret_cast<CRGB*>(p), leds, amount); },
+                          [&](uint8_t* p, const uint8_t*) { refBlur1d(reinterpret_cast<CRGB*>(p), leds, amount); });
+    }
+  }
+  check(blurOk, "blur1d differs from FastLED's carry loop");
+}
+
+// Mean ns per fadeToBlackBy of 1500 LEDs: the kernel, or the scalar reference
+static volatile uint8_t sink;
+
+static double fadeNs(bool kernel, int runs) {
+  static CRGB leds[1500];
+  randomize(reinterpret_cast<uint8_t*>(leds), sizeof(leds));
+  auto start = std::chrono::steady_clock::now();
+  for (int r = 0; r < runs; r++) {
+    if (kernel) {
+      fadeToBlackBy(leds, 1500, 1);
+    } else {
+      refScale8(reinterpret_cast<uint8_t*>(leds), 1500 * 3, 254);
+    }
+    sink = sink + leds[r % 1500].r;
+  }
+  return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / runs;
+}
+
+int main() {
+#if SIM_SIMD_AVX2 && defined(__GNUC__)
+  if (!__builtin_cpu_supports("avx2")) {
+    printf("{\"checks\": \"skipped\", \"path\": \"avx2\", \"reason\": \"CPU without AVX2\"}\n");
+    return 0;
+  }
+#endif
+  checkKernels();
+  double kernelNs = fadeNs(true, 20000);
+  double scalarNs = fadeNs(false, 20000);
+  printf("{\"checks\": \"%s\", \"failures\": %d, \"path\": \"%s\", \"cases\": %d, \"fade_1500_ns\": %.0f, "
+         "\"scalar_fade_1500_ns\": %.0f}\n",
+         failures ? "failed" : "ok", failures, kPath, cases, kernelNs, scalarNs);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,255 @@
+// Upload parser bench / check: runs the designer's JSON upload through the streaming
+// SparseJsonParser (src/sparse_json_parser.h) in server-sized blocks and through the
+// previous firmware path (whole body collected into a String, then scanned with indexOf),
+// checks they decode the same frame, and reports throughput and heap use of each. Also
+// feeds malformed bodies and checks they are rejected where expected.
+//
+// Heap figures come from counting operator new / delete, so "peak_heap" is what each path
+// allocates per upload on top of the LED buffer. Exit status 1 on any mismatch.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "sparse_json_parser.h"
+
+// --- heap accounting -------------------------------------------------------------------
+
+static size_t heapLive = 0;
+static size_t heapPeak = 0;
+static size_t heapAllocs = 0;
+
+void* operator new(size_t size) {
+  size_t* p = static_cast<size_t*>(malloc(size + sizeof(size_t)));
+  if (!p) throw std::bad_alloc();
+  *p = size;
+  heapLive += size;
+  heapAllocs++;
+  heapPeak = std::max(heapPeak, heapLive);
+  return p + 1;
+}
+
+void operator delete(void* ptr) noexcept {
+  if (!ptr) return;
+  size_t* p = static_cast<size_t*>(ptr) - 1;
+  heapLive -= *p;
+  free(p);
+}
+
+void operator delete(void* ptr, size_t) noexcept { operator delete(ptr); }
+
+static void heapMark() {
+  heapPeak = heapLive;
+  heapAllocs = 0;
+}
+
+// --- previous firmware path ------------------------------------------------------------
+
+// The part of Arduino's String the old handler used. Grows like String::concat (exact
+// reserve per append), which is what ESP8266WebServer does while reading the body.
+class LegacyString {
+ public:
+  void concat(const char* data, size_t len) {
+    char* grown = new char[len_ + len + 1];
+    if (buf_) memcpy(grown, buf_, len_);
+    memcpy(grown + len_, data, len);
+    grown[len_ + len] = '\0';
+    delete[] buf_;
+    buf_ = grown;
+    len_ += len;
+  }
+  ~LegacyString() { delete[] buf_; }
+  unsigned int length() const { return len_; }
+  char operator[](unsigned int i) const { return i < len_ ? buf_[i] : '\0'; }
+  int indexOf(const char* s) const {
+    const char* hit = buf_ ? strstr(buf_, s) : nullptr;
+    return hit ? static_cast<int>(hit - buf_) : -1;
+  }
+
+ private:
+  char* buf_ = nullptr;
+  unsigned int len_ = 0;
+};
+
+// handleUploadPattern() before the streaming parser, minus the HTTP calls. Returns the
+// pixel count, -1 when "sparse" is missing.
+static int legacyParse(const LegacyString& body, CRGB* out, int count) {
+  for (int i = 0; i < count; i++) out[i] = CRGB(0, 0, 0);
+  int sparseStart = body.indexOf("\"sparse\":[");
+  if (sparseStart == -1) return -1;
+
+  int pixelCount = 0;
+  unsigned int pos = sparseStart + 10;
+  while (pos < body.length()) {
+    while (pos < body.length() && (body[pos] == ' ' || body[pos] == '\n')) pos++;
+    if (body[pos] == '[') {
+      pos++;
+      int v[4] = {0, 0, 0, 0};
+      for (int f = 0; f < 4; f++) {
+        while (pos < body.length() && body[pos] >= '0' && body[pos] <= '9') {
+          v[f] = v[f] * 10 + (body[pos] - '0');
+          pos++;
+        }
+        if (f < 3) while (pos < body.length() && body[pos] == ',') pos++;
+      }
+      if (v[0] >= 0 && v[0] < count) {
+        out[v[0]] = CRGB(v[1], v[2], v[3]);
+        pixelCount++;
+      }
+      while (pos < body.length() && body[pos] != '[' && body[pos] != ']') pos++;
+      if (body[pos] == ']') pos++;
+      if (body[pos] == ',') pos++;
+    } else if (body[pos] == ']') {
+      break;
+    } else {
+      pos++;
+    }
+  }
+  return pixelCount;
+}
+
+// --- payloads --------------------------------------------------------------------------
+
+static const int kLeds = GRID_WIDTH * GRID_HEIGHT;
+static const size_t kBlock = 1436;  // HTTP_RAW_BUFLEN of the ESP8266 core
+
+// Designer-style body: every `stride`th LED lit, compact JSON as JSON.stringify writes it
+static std::string makeUpload(int stride, uint32_t seed) {
+  std::string s = "{\"sparse\":[";
+  bool first = true;
+  for (int i = 0; i < kLeds; i += stride) {
+    seed = seed * 1103515245u + 12345u;
+    char rec[32];
+    snprintf(rec, sizeof(rec), "%s[%d,%u,%u,%u]", first ? "" : ",", i, (seed >> 8) & 255,
+             (seed >> 16) & 255, (seed >> 24) & 255);
+    s += rec;
+    first = false;
+  }
+  s += "],\"scrollSpeed\":80}";
+  return s;
+}
+
+struct PathResult {
+  double mbPerSec;
+  size_t peakHeap;
+  size_t allocs;
+};
+
+template <typename Fn>
+static double timeRuns(int runs, Fn fn) {
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < runs; i++) fn();
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+static bool runPayload(const char* name, const std::string& body, int runs) {
+  static CRGB legacyOut[MAX_LEDS];
+  static CRGB streamOut[MAX_LEDS];
+  static SparseJsonParser parser;
+
+  int legacyPixels = 0;
+  auto legacy = [&]() {
+    LegacyString s;
+    for (size_t off = 0; off < body.size(); off += kBlock) {
+      s.concat(body.data() + off, std::min(kBlock, body.size() - off));
+    }
+    legacyPixels = legacyParse(s, legacyOut, MAX_LEDS);
+  };
+  bool ok = true;
+  auto streaming = [&]() {
+    parser.begin(streamOut, MAX_LEDS);
+    for (size_t off = 0; off < body.size(); off += kBlock) {
+      parser.feed(body.data() + off, std::min(kBlock, body.size() - off));
+    }
+    ok = parser.finish();
+  };
+
+  PathResult res[2];
+  for (int path = 0; path < 2; path++) {
+    heapMark();
+    size_t base = heapLive;
+    path == 0 ? legacy() : streaming();
+    res[path].peakHeap = heapPeak - base;
+    res[path].allocs = heapAllocs;
+    double secs = path == 0 ? timeRuns(runs, legacy) : timeRuns(runs, streaming);
+    res[path].mbPerSec = body.size() * (double)runs / secs / 1e6;
+  }
+
+  bool same = ok && legacyPixels == (int)parser.pixels() && parser.scrollSpeed() == 80 &&
+              memcmp(legacyOut, streamOut, sizeof(legacyOut)) == 0;
+  printf("{\"payload\": \"%s\", \"bytes\": %zu, \"pixels\": %u, "
+         "\"legacy_mb_s\": %.1f, \"legacy_peak_heap\": %zu, \"legacy_allocs\": %zu, "
+         "\"stream_mb_s\": %.1f, \"stream_peak_heap\": %zu, \"stream_allocs\": %zu, \"match\": %s}\n",
+         name, body.size(), parser.pixels(), res[0].mbPerSec, res[0].peakHeap, res[0].allocs,
+         res[1].mbPerSec, res[1].peakHeap, res[1].allocs, same ? "true" : "false");
+  return same;
+}
+
+// --- malformed input -------------------------------------------------------------------
+
+struct BadCase {
+  const char* body;
+  uint32_t offset;  // byte the parser should stop at
+};
+
+static bool runRejects() {
+  static const BadCase kCases[] = {
+      {"", 0},
+      {"[]", 0},
+      {"{\"sparse\":[[1,2,3]]}", 17},
+      {"{\"sparse\":[[1,2,3,4,5]]}", 19},
+      {"{\"sparse\":[[1,2,300,4]]}", 19},
+      {"{\"sparse\":[[1,-2,3,4]]}", 14},
+      {"{\"sparse\":[[1,2,3,4]],}", 22},
+      {"{\"sparse\":{}}", 10},
+      {"{\"sparse\":[[1,2,3,4]]} x", 23},
+      {"{\"scrollSpeed\":80}", 18},
+      {"{\"sparse\":[[1,2,3,4]]", 21},
+      {"{\"sparse\":[[1,2,3,4]],\"scrollSpeed\":\"fast\"}", 36},
+  };
+  static CRGB out[MAX_LEDS];
+  bool all = true;
+  for (const BadCase& c : kCases) {
+    SparseJsonParser parser;
+    parser.begin(out, MAX_LEDS);
+    // One byte per block: a state must survive any split
+    for (const char* p = c.body; *p; p++) parser.feed(p, 1);
+    bool rejected = !parser.finish() && parser.errorOffset() == c.offset;
+    if (!rejected) {
+      fprintf(stderr, "not rejected at byte %u: %s (%s at %u)\n", c.offset, c.body,
+              parser.error() ? parser.error() : "accepted", parser.errorOffset());
+      all = false;
+    }
+  }
+
+  // Unknown keys and whitespace are fine
+  SparseJsonParser parser;
+  parser.begin(out, MAX_LEDS);
+  const char* body = " {\"name\":\"a \\\"b\\\" ]}\", \"meta\": {\"x\":[1,{\"y\":2}]}, \"sparse\" : [ [ 5 , 1 , 2 , 3 ] ,"
+                     "[99999,1,1,1]], \"v\": -1.5e3 }\n";
+  parser.feed(body, strlen(body));
+  if (!parser.finish() || parser.pixels() != 1 || parser.dropped() != 1 || out[5].b != 3) {
+    fprintf(stderr, "valid body with extra keys rejected: %s\n", parser.error() ? parser.error() : "wrong pixels");
+    all = false;
+  }
+  printf("{\"rejects\": %zu, \"ok\": %s, \"parser_bytes\": %zu}\n", sizeof(kCases) / sizeof(kCases[0]),
+         all ? "true" : "false", sizeof(SparseJsonParser));
+  return all;
+}
+
+int main(int argc, char** argv) {
+  int runs = argc > 1 ? atoi(argv[1]) : 200;
+  if (runs <= 0) runs = 200;
+  bool ok = true;
+  ok &= runPayload("sparse_10pct", makeUpload(10, 1), runs);
+  ok &= runPayload("half", makeUpload(2, 2), runs);
+  ok &= runPayload("full_frame", makeUpload(1, 3), runs);
+  ok &= runRejects();
+  return ok ? 0 : 1;
+}
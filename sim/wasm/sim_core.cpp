@@ -1,24 +1,71 @@
-// WASM simulator core: runs 2D patterns (100-120) and exposes a C ABI for JS.
+// WASM simulator core: runs the registry patterns built for SIMULATOR (2D, 100-121) and
+// exposes a C ABI for JS.
 // This compiles with Emscripten using the SIMULATOR shims in platform.h.
 
+#ifndef SIMULATOR
 #define SIMULATOR
+#endif
 
 #include <algorithm>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <string>
+#include <vector>
 
-#include "../../src/patterns.h"
+#include "sim_core.h"
+
+#include "../../src/pattern_registry.h"
+#include "../../src/frame_tracker.h"
+#include "../../src/output_stage.h"
+#include "../../src/render_profiler.h"
+#include "../../src/flipbook.h"
+#include "../../src/palette.h"
 
 static CRGB leds[MAX_LEDS];
+static CRGB frame[MAX_LEDS];     // leds after the output stage: what the strip shows
+static OutputStage outputStage;  // identity until sim_set_output()
 static int activeLeds = GRID_WIDTH * GRID_HEIGHT;
 static int currentPattern = 100;
+static PatternInstance pattern;
 static uint8_t hue = 0;
 static std::string scrollText = "HELLO WORLD";
 static int scrollOffset = 0;
 static int scrollSpeed = 80; // ms
+static PaletteEngine palettes;  // sim_set_palette(); scheme 0 (rainbow) after sim_init
 unsigned long (*sim_millis_fn)() = nullptr;
 static uint64_t sim_time_ms = 0;
+static FrameTracker frameTracker;
+static int sendCount = 0;
+static uint32_t frameIndex = 0;  // frames stepped since sim_init
+static RenderProfiler profiler;  // render / output timings per pattern (sim_get_stats)
+static uint32_t* traceEvents = nullptr;  // sim_set_trace() buffer, 4 x uint32 per event
+static int traceMax = 0;
+static int traceCount = 0;
+
+// sim_set_flipbook() data, read by the player through a fixed buffer like the LittleFS file
+struct FlipbookMemory {
+  std::vector<uint8_t> data;
+  size_t pos = 0;
+};
+static FlipbookMemory flipbookData;
+static FlipbookPlayer flipbook;
+
+static int flipbookRead(void* ctx, uint8_t* buf, int n) {
+  FlipbookMemory* m = static_cast<FlipbookMemory*>(ctx);
+  size_t take = std::min(static_cast<size_t>(n), m->data.size() - m->pos);
+  memcpy(buf, m->data.data() + m->pos, take);
+  m->pos += take;
+  return static_cast<int>(take);
+}
+
+static bool flipbookSeek(void* ctx, uint32_t offset) {
+  FlipbookMemory* m = static_cast<FlipbookMemory*>(ctx);
+  if (offset > m->data.size()) return false;
+  m->pos = offset;
+  return true;
+}
+
 static unsigned long wasm_millis() {
   return static_cast<unsigned long>(sim_time_ms);
 }
@@ -32,39 +79,55 @@ static inline void clearTail() {
 }
 
 static void runPattern() {
-  switch (currentPattern) {
-    case 100: pattern_horizontal_bars(leds, activeLeds, hue); break;
-    case 101: pattern_vertical_ripple(leds, activeLeds, hue); break;
-    case 102: pattern_fire_rising(leds, activeLeds, hue); break;
-    case 103: pattern_rain_drops(leds, activeLeds, hue); break;
-    case 104: pattern_vertical_equalizer(leds, activeLeds, hue); break;
-    case 105: pattern_scanning_lines(leds, activeLeds, hue); break;
-    case 106: pattern_checkerboard(leds, activeLeds, hue); break;
-    case 107: pattern_diagonal_sweep(leds, activeLeds, hue); break;
-    case 108: pattern_vertical_wave(leds, activeLeds, hue); break;
-    case 109: pattern_plasma_2d(leds, activeLeds, hue); break;
-    case 110: pattern_matrix_rain(leds, activeLeds, hue); break;
-    case 111: pattern_game_of_life(leds, activeLeds, hue); break;
-    case 112: pattern_wave_pool(leds, activeLeds, hue); break;
-    case 113: pattern_aurora_2d(leds, activeLeds, hue); break;
-    case 114: pattern_lava_lamp(leds, activeLeds, hue); break;
-    case 115: pattern_ripple_2d(leds, activeLeds, hue); break;
-    case 116: pattern_starfield(leds, activeLeds, hue); break;
-    case 117: pattern_side_fire(leds, activeLeds, hue); break;
-    case 118: pattern_scrolling_rainbow(leds, activeLeds, hue); break;
-    case 119: pattern_particle_fountain(leds, activeLeds, hue); break;
-    case 120:
-      pattern_scrolling_text(leds, activeLeds, hue, scrollText.c_str(), scrollOffset, scrollSpeed);
-      break;
-    case 121: pattern_test_card(leds, activeLeds, hue); break;
-    default:
-      fill_solid(leds, activeLeds, CRGB::Black);
-      break;
-  }
+  PatternParams params;
+  params.text = scrollText.c_str();
+  params.scrollOffset = &scrollOffset;
+  params.scrollSpeed = scrollSpeed;
+  params.custom = nullptr;
+  params.customScrollMs = 0;
+  params.flipbook = flipbook.isOpen() ? &flipbook : nullptr;
+  palettes.update(wasm_millis());
+  params.palette = palettes.lut();
+  pattern.activate(currentPattern);
+  pattern.render(leds, activeLeds, hue, params);
 
   clearTail();
 }
 
+static void endPhase(RenderProfiler::Phase phase) {
+  uint32_t ticks = profiler.end(phase);
+  if (traceCount < traceMax) {
+    uint32_t* e = traceEvents + 4 * traceCount++;
+    e[0] = phase;
+    e[1] = static_cast<uint32_t>(currentPattern);
+    e[2] = profiler.begunAt(phase);
+    e[3] = ticks;
+  }
+}
+
+static void stepOnce(uint32_t delta_ms) {
+  sim_time_ms += (delta_ms > 0) ? delta_ms : 16;
+  profiler.setPattern(currentPattern);
+  profiler.begin(RenderProfiler::PHASE_RENDER);
+  runPattern();
+  endPhase(RenderProfiler::PHASE_RENDER);
+  // The output stage and frame tracker stand in for FastLED.show()
+  profiler.begin(RenderProfiler::PHASE_SHOW);
+  outputStage.apply(leds, frame, activeLeds);
+  sendCount = frameTracker.pending(leds, MAX_LEDS);
+  if (outputStage.limitChanged()) sendCount = MAX_LEDS;  // the rest was sent at the old limit
+  endPhase(RenderProfiler::PHASE_SHOW);
+  frameIndex++;
+}
+
+static uint32_t countLit() {
+  uint32_t lit = 0;
+  for (int i = 0; i < activeLeds; i++) {
+    if (frame[i].r | frame[i].g | frame[i].b) lit++;
+  }
+  return lit;
+}
+
 extern "C" {
 
 void sim_init(int width, int height) {
@@ -74,7 +137,14 @@ void sim_init(int width, int height) {
     activeLeds = GRID_WIDTH * GRID_HEIGHT;
   }
   sim_time_ms = 0;
+  frameIndex = 0;
+  hue = 0;           // a run must not depend on the patterns stepped before it
+  scrollOffset = 0;
+  palettes.select(0, false);
+  palettes.update(0);
   sim_millis_fn = wasm_millis;
+  pattern.deactivate();  // next step starts the pattern from fresh state
+  frameTracker.invalidate();
   clearTail();
 }
 
@@ -91,19 +161,164 @@ void sim_set_text(const char* txt) {
   scrollOffset = 0;
 }
 
+// Selects color scheme `id` (blended over from the current one); 0 if there is no such scheme
+int sim_set_palette(int id) {
+  return palettes.select(id) ? 1 : 0;
+}
+
 void sim_seed(uint32_t seed) {
-  srand(seed);
+  // FastLED's LCG is 16 bits; fold the upper half in
+  uint16_t s = static_cast<uint16_t>(seed ^ (seed >> 16));
+  random16_set_seed(s);
+  pattern.seed(s);
 }
 
 // Run one frame; advance simulated millis by delta (fallback to ~60 FPS if delta is 0).
 void sim_step(uint32_t delta_ms) {
-  sim_time_ms += (delta_ms > 0) ? delta_ms : 16;
-  runPattern();
+  stepOnce(delta_ms);
+}
+
+// Runs `count` frames in one call, for headless capture (thumbnails, scrubbing, golden
+// frames) without a JS<->WASM round trip per frame. Frame k (k = sim_get_frame_index()
+// before the frame) goes to slot k % ring_frames:
+//   out  + slot * sim_get_buffer_length()  - RGB888 in strip order, skipped if out is null
+//   meta + slot                            - SimFrameMeta, skipped if meta is null
+// ring_frames <= 0 means the buffers hold all `count` frames starting at slot 0.
+// Returns the number of frames rendered.
+int sim_step_n(int count, uint32_t delta_ms, uint8_t* out, int ring_frames, SimFrameMeta* meta) {
+  if (count <= 0) return 0;
+  const int frameBytes = activeLeds * 3;
+  const uint32_t first = frameIndex;
+  for (int i = 0; i < count; i++) {
+    stepOnce(delta_ms);
+    int slot = (ring_frames > 0) ? static_cast<int>((first + i) % ring_frames) : i;
+    if (out) {
+      memcpy(out + static_cast<size_t>(slot) * frameBytes, frame, frameBytes);
+    }
+    if (meta) {
+      SimFrameMeta& m = meta[slot];
+      m.index = first + i;
+      m.timeMs = static_cast<uint32_t>(sim_time_ms);
+      m.hash = FrameTracker::hash(reinterpret_cast<const uint8_t*>(frame), frameBytes);
+      m.lit = countLit();
+      m.sent = sendCount;
+      m.powerMw = outputStage.lastPower().drawMw;
+    }
+  }
+  return count;
 }
 
-// Raw RGB buffer (RGB888) in strip order (zigzagged via XY mapping inside patterns).
+uint32_t sim_get_frame_index() {
+  return frameIndex;
+}
+
+int sim_get_frame_meta_size() {
+  return sizeof(SimFrameMeta);
+}
+
+// RGB buffer (RGB888) in strip order (wiring from sim_get_led_map()), after the output
+// stage: the bytes the firmware would send.
 uint8_t* sim_get_buffer() {
-  return reinterpret_cast<uint8_t*>(leds);
+  return reinterpret_cast<uint8_t*>(frame);
+}
+
+// Output stage settings as on the device (src/output_stage.h): brightness 0-255, gamma in
+// tenths (10 = linear), correction 0xRRGGBB (0xFFB0F0 = TypicalLEDStrip, 0xFFFFFF = off).
+// Defaults to 255 / 10 / 0xFFFFFF, i.e. the raw pattern buffer. Applies from the next step.
+void sim_set_output(int brightness, int gamma10, uint32_t correction) {
+  if (outputStage.configure(static_cast<uint8_t>(std::clamp(brightness, 0, 255)),
+                            static_cast<uint8_t>(std::clamp(gamma10, 10, 30)), correction)) {
+    frameTracker.invalidate();
+  }
+}
+
+// Power limit for the whole chain in mW (0 = none), as POWER_BUDGET_MW / `/set?mw=` on the
+// device. Frames over it are scaled down to fit.
+void sim_set_power_budget(uint32_t mw) {
+  outputStage.setPowerBudget(mw);
+}
+
+// Estimated draw of the last frame in mW at 5 V, after limiting (FastLED's power model).
+uint32_t sim_get_power_mw() {
+  return outputStage.lastPower().drawMw;
+}
+
+// Last frames' power samples, oldest first, as at most `max` triples of uint32:
+// out[3k] = estimated mW as rendered, out[3k + 1] = after limiting, out[3k + 2] = limiter
+// scale (255 = none). Returns the number of triples written (up to 64).
+int sim_get_power_history(uint32_t* out, int max) {
+  if (!out || max <= 0) return 0;
+  OutputStage::PowerSample samples[OutputStage::kPowerHistory];
+  int n = outputStage.powerHistory(samples, std::min(max, OutputStage::kPowerHistory));
+  for (int i = 0; i < n; i++) {
+    out[3 * i] = samples[i].requestedMw;
+    out[3 * i + 1] = samples[i].drawMw;
+    out[3 * i + 2] = samples[i].limit;
+  }
+  return n;
+}
+
+// Rolling render / output timings per pattern, as /metrics on the device
+// (src/render_profiler.h; "show" here is the output stage, there is no wire). Writes up to
+// `max` rows of 7 uint32 - pattern id, phase (0 = render, 1 = show), samples, min_ns,
+// avg_ns, max_ns, p99_ns - for the last RenderProfiler::kSlots patterns stepped, and
+// returns the number of rows. Timings are wall clock, so they vary between runs.
+int sim_get_stats(uint32_t* out, int max) {
+  if (!out || max <= 0) return 0;
+  int rows = 0;
+  for (int slot = 0; slot < RenderProfiler::kSlots; slot++) {
+    int id = profiler.slotPattern(slot);
+    if (id < 0) continue;
+    for (int p = RenderProfiler::PHASE_RENDER; p <= RenderProfiler::PHASE_SHOW && rows < max; p++) {
+      RenderProfiler::Summary s = profiler.summary(slot, static_cast<RenderProfiler::Phase>(p));
+      uint32_t* row = out + 7 * rows++;
+      row[0] = static_cast<uint32_t>(id);
+      row[1] = static_cast<uint32_t>(p);
+      row[2] = s.count;
+      row[3] = s.minNs;
+      row[4] = s.avgNs;
+      row[5] = s.maxNs;
+      row[6] = s.p99Ns;
+    }
+  }
+  return rows;
+}
+
+void sim_reset_stats() {
+  profiler.reset();
+}
+
+// Records every phase of the following steps into `events` (4 x uint32 each: phase,
+// pattern id, start ns, duration ns; the start is a free-running 32-bit clock) until `max`
+// events are stored. sim_set_trace(nullptr, 0) stops recording. For Chrome-trace export
+// (sim_bench --trace).
+void sim_set_trace(uint32_t* events, int max) {
+  traceEvents = events;
+  traceMax = events ? std::max(max, 0) : 0;
+  traceCount = 0;
+}
+
+int sim_get_trace_count() {
+  return traceCount;
+}
+
+// Animation for pattern 123 (src/flipbook.h), as stored by /uploadFlipbook on the device.
+// The data is copied. Returns the number of frames, or -1 if it is not a valid flipbook
+// (pattern 123 then draws black).
+int sim_set_flipbook(const uint8_t* data, int len) {
+  flipbookData.data.assign(data, data + std::max(len, 0));
+  flipbookData.pos = 0;
+  if (!flipbook.open(flipbookRead, flipbookSeek, &flipbookData) ||
+      !flipbook.validate(static_cast<uint32_t>(flipbookData.data.size()))) {
+    flipbook.close();
+    return -1;
+  }
+  return flipbook.frameCount();
+}
+
+// LEDs the firmware would clock out for the last sim_step (0 = show() skipped).
+int sim_get_send_count() {
+  return sendCount;
 }
 
 int sim_get_buffer_length() {
@@ -117,4 +332,45 @@ int sim_get_led_count() {
 int sim_get_grid_width() { return GRID_WIDTH; }
 int sim_get_grid_height() { return GRID_HEIGHT; }
 
+// Wiring layout / orientation (LedLayout, LedOrientation in src/led_map.h).
+void sim_set_layout(int layout, int orientation) {
+  ledMapInit(static_cast<uint8_t>(layout), static_cast<uint8_t>(orientation));
+  fill_solid(leds, MAX_LEDS, CRGB::Black);
+  fill_solid(frame, MAX_LEDS, CRGB::Black);
+}
+
+// Grid -> strip index table (GRID_WIDTH * GRID_HEIGHT uint16), for drawing the buffer in grid space.
+const uint16_t* sim_get_led_map() {
+  return ledMap;
+}
+
+// Pattern list from the registry, in table order (index 0..count-1).
+int sim_get_pattern_count() {
+  return patternCount();
+}
+
+int sim_get_pattern_id(int index) {
+  PatternDesc desc;
+  return patternAt(index, desc) ? desc.id : -1;
+}
+
+const char* sim_get_pattern_name(int index) {
+  PatternDesc desc;
+  return patternAt(index, desc) ? desc.name : "";
+}
+
+int sim_get_palette_count() {
+  return PaletteEngine::count();
+}
+
+const char* sim_get_palette_name(int id) {
+  const char* name = PaletteEngine::name(id);
+  return name ? name : "";
+}
+
+int sim_get_pattern_flags(int index) {
+  PatternDesc desc;
+  return patternAt(index, desc) ? desc.flags : 0;
+}
+
 } // extern "C"
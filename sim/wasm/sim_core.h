@@ -0,0 +1,65 @@
+#ifndef SIM_CORE_H
+#define SIM_CORE_H
+
+// C ABI of the simulator core (sim_core.cpp), shared by the core, the native tools in
+// sim/native/ and, through the same names, the WASM exports (scripts/build_sim_wasm.sh).
+// What each call does is in sim/wasm/README.md.
+
+#include <cstdint>
+
+// Per-frame record written by sim_step_n (6 x uint32, read from JS through HEAPU32).
+struct SimFrameMeta {
+  uint32_t index;    // frame number since sim_init
+  uint32_t timeMs;   // simulated millis() the frame was rendered at
+  uint32_t hash;     // FNV-1a of the frame's RGB bytes (FrameTracker::hash)
+  uint32_t lit;      // LEDs that are not black
+  uint32_t sent;     // LEDs the firmware would clock out (sim_get_send_count)
+  uint32_t powerMw;  // estimated draw after the power limiter (sim_get_power_mw)
+};
+
+extern "C" {
+// Setup and input
+void sim_init(int width, int height);
+void sim_set_pattern(int pattern);
+void sim_set_scroll_speed(int speed_ms);
+void sim_set_text(const char* txt);
+int sim_set_palette(int id);
+void sim_seed(uint32_t seed);
+int sim_set_flipbook(const uint8_t* data, int len);
+void sim_set_layout(int layout, int orientation);
+
+// Stepping
+void sim_step(uint32_t delta_ms);
+int sim_step_n(int count, uint32_t delta_ms, uint8_t* out, int ring_frames, SimFrameMeta* meta);
+uint32_t sim_get_frame_index();
+int sim_get_frame_meta_size();
+
+// Frame buffer and output stage
+uint8_t* sim_get_buffer();
+int sim_get_buffer_length();
+int sim_get_send_count();
+int sim_get_led_count();
+int sim_get_grid_width();
+int sim_get_grid_height();
+const uint16_t* sim_get_led_map();
+void sim_set_output(int brightness, int gamma10, uint32_t correction);
+void sim_set_power_budget(uint32_t mw);
+uint32_t sim_get_power_mw();
+int sim_get_power_history(uint32_t* out, int max);
+
+// Timings
+int sim_get_stats(uint32_t* out, int max);
+void sim_reset_stats();
+void sim_set_trace(uint32_t* events, int max);
+int sim_get_trace_count();
+
+// Registry
+int sim_get_pattern_count();
+int sim_get_pattern_id(int index);
+const char* sim_get_pattern_name(int index);
+int sim_get_pattern_flags(int index);
+int sim_get_palette_count();
+const char* sim_get_palette_name(int id);
+}
+
+#endif // SIM_CORE_H
@@ -0,0 +1,163 @@
+#ifndef EVENT_STREAM_H
+#define EVENT_STREAM_H
+
+#include "platform.h"
+
+// Server-Sent Events fan-out (/events): pushes the latest state snapshot to every open
+// control page. There is one event buffer shared by all connections and no queue per
+// connection. A client whose TCP send window cannot take the whole event stays pending and
+// later gets whatever is current then, so intermediate states are skipped (coalesced). The
+// loop never waits on a socket, and a slow phone costs no more RAM than its slot.
+// Connections are capped at kMaxClients, since lwIP has few TCP connections to spare, and a
+// client that stays blocked for kStallMs is closed.
+//
+//   WiFiClient client = server.client();
+//   if (!events.add(client, millis())) reply 503
+//   events.publish(json, len);   // whenever the state changes
+//   events.poll(millis());       // every loop: writes, keep-alives, drops dead clients
+//
+// Client is WiFiClient on the device: connected(), availableForWrite(),
+// write(const uint8_t*, size_t) and stop().
+template <typename Client, int kMaxClients = 3>
+class EventStream {
+ public:
+  static const int kMaxEvent = 384;            // bytes of event data (one line of JSON)
+  static const uint32_t kKeepAliveMs = 15000;  // comment line on an otherwise idle stream
+  static const uint32_t kStallMs = 10000;      // blocked this long: the client is closed
+  static const uint32_t kRetryMs = 3000;       // browser reconnect delay
+
+  struct Stats {
+    uint32_t accepted;   // connections taken
+    uint32_t rejected;   // refused at the cap
+    uint32_t sent;       // events written
+    uint32_t coalesced;  // events replaced before a client could take them
+    uint32_t stalled;    // clients closed for not reading
+    uint32_t closed;     // clients gone (including stalled)
+  };
+
+  EventStream() : len_(0) {
+    memset(&stats_, 0, sizeof(stats_));
+    for (int i = 0; i < kMaxClients; i++) slots_[i].used = false;
+  }
+
+  // Takes over the connection of an HTTP request: writes the event-stream response head
+  // and queues the current event. False when every slot is taken or the head cannot be
+  // written.
+  bool add(const Client& client, unsigned long nowMs) {
+    Slot* s = nullptr;
+    for (int i = 0; i < kMaxClients && !s; i++) {
+      if (!slots_[i].used) s = &slots_[i];
+    }
+    if (!s) {
+      stats_.rejected++;
+      return false;
+    }
+    s->client = client;
+    char head[192];
+    int n = snprintf(head, sizeof(head),
+                     "HTTP/1.1 200 OK\r\nContent-Type: text/event-stream\r\nCache-Control: no-cache\r\n"
+                     "Connection: keep-alive\r\nAccess-Control-Allow-Origin: *\r\n\r\nretry: %lu\n\n",
+                     (unsigned long)kRetryMs);
+    if (s->client.write(reinterpret_cast<const uint8_t*>(head), (size_t)n) != (size_t)n) {
+      s->client.stop();
+      s->client = Client();
+      stats_.rejected++;
+      return false;
+    }
+    s->used = true;
+    s->pending = len_ > 0;
+    s->lastWriteMs = nowMs;
+    s->blocked = false;
+    stats_.accepted++;
+    return true;
+  }
+
+  // Replaces the current event with `data` (no newlines, up to kMaxEvent bytes) and marks
+  // it pending for every client. False if the data cannot be sent as one event.
+  bool publish(const char* data, size_t len) {
+    if (len > (size_t)kMaxEvent || memchr(data, '\n', len)) return false;
+    memcpy(event_, "data: ", 6);
+    memcpy(event_ + 6, data, len);
+    event_[6 + len] = '\n';
+    event_[7 + len] = '\n';
+    len_ = len + 8;
+    for (int i = 0; i < kMaxClients; i++) {
+      if (!slots_[i].used) continue;
+      if (slots_[i].pending) stats_.coalesced++;
+      slots_[i].pending = true;
+    }
+    return true;
+  }
+
+  // Writes the current event to every client that has room for all of it
+  void poll(unsigned long nowMs) {
+    for (int i = 0; i < kMaxClients; i++) {
+      Slot& s = slots_[i];
+      if (!s.used) continue;
+      if (!s.client.connected()) {
+        close(s);
+        continue;
+      }
+      if (s.pending) {
+        if (tryWrite(s, event_, len_, nowMs)) {
+          s.pending = false;
+          stats_.sent++;
+        } else if (!s.blocked) {
+          s.blocked = true;
+          s.blockedSinceMs = nowMs;
+        } else if (nowMs - s.blockedSinceMs >= kStallMs) {
+          stats_.stalled++;
+          close(s);
+          continue;
+        }
+      } else if (nowMs - s.lastWriteMs >= kKeepAliveMs) {
+        static const uint8_t kKeepAlive[] = { ':', '\n', '\n' };
+        tryWrite(s, kKeepAlive, sizeof(kKeepAlive), nowMs);
+      }
+    }
+  }
+
+  int clients() const {
+    int n = 0;
+    for (int i = 0; i < kMaxClients; i++) n += slots_[i].used;
+    return n;
+  }
+
+  const Stats& stats() const { return stats_; }
+
+ private:
+  struct Slot {
+    Client client;
+    bool used;
+    bool pending;  // the current event has not been written yet
+    bool blocked;  // a write of it found no room, first at blockedSinceMs
+    unsigned long lastWriteMs;
+    unsigned long blockedSinceMs;
+  };
+
+  // All or nothing: a partial event would corrupt the stream
+  bool tryWrite(Slot& s, const uint8_t* data, size_t len, unsigned long nowMs) {
+    if ((size_t)s.client.availableForWrite() < len) return false;
+    if (s.client.write(data, len) != len) {
+      s.client.stop();  // the next poll() sees it disconnected
+      return false;
+    }
+    s.blocked = false;
+    s.lastWriteMs = nowMs;
+    return true;
+  }
+
+  void close(Slot& s) {
+    s.client.stop();
+    s.client = Client();
+    s.used = false;
+    stats_.closed++;
+  }
+
+  Slot slots_[kMaxClients];
+  uint8_t event_[kMaxEvent + 8];  // "data: " + data + "\n\n"
+  size_t len_;
+  Stats stats_;
+};
+
+#endif // EVENT_STREAM_H
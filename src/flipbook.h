@@ -0,0 +1,263 @@
+#ifndef FLIPBOOK_H
+#define FLIPBOOK_H
+
+#include "platform.h"
+
+// Flipbook: a designed animation stored as a file (LittleFS on the device) and played a
+// frame at a time. The player never holds more than one frame - the one in leds[] - plus a
+// kReadBuffer-byte read buffer, so the length of an animation only costs flash.
+//
+// File layout, all numbers little endian:
+//   header   "NPFB", version (1), reserved (0), LED count (uint16), frame count (uint16)
+//   frames   type (uint8), duration in ms (uint16), payload length (uint16), payload
+// Frame payloads:
+//   FLIPBOOK_KEY    runs of count (1..255), r, g, b covering the LEDs from index 0 on
+//   FLIPBOOK_DELTA  XOR against the previous frame: skip (0..255 unchanged LEDs),
+//                   n (0..255), then n x r, g, b XOR values for the LEDs after the skipped
+//                   ones; repeated until the payload ends
+// A delta frame only decodes correctly on top of the frame before it, so playback restarts
+// from frame 0 whenever that may not hold; the encoder puts in a key frame every so often
+// (and wherever one is smaller) so a disturbed picture recovers quickly anyway.
+//
+//   FlipbookPlayer player;
+//   player.open(readFile, seekFile, &file);   // checks the header
+//   player.nextFrame(leds, activeLeds);        // frame 0, then 1, ... wrapping around
+//   ... wait player.duration() ms ...
+
+enum FlipbookFrameType : uint8_t { FLIPBOOK_KEY, FLIPBOOK_DELTA };
+
+static const int kFlipbookHeaderBytes = 10;
+static const int kFlipbookFrameHeaderBytes = 5;
+
+// Frame payload encoders (the native flipbook tool; the device only plays). Both return
+// the payload size, or 0 if it does not fit in `cap` bytes.
+inline size_t flipbookEncodeKey(const CRGB* cur, int count, uint8_t* out, size_t cap) {
+  size_t n = 0;
+  for (int i = 0; i < count;) {
+    int run = 1;
+    while (i + run < count && run < 255 && cur[i + run].r == cur[i].r && cur[i + run].g == cur[i].g &&
+           cur[i + run].b == cur[i].b) {
+      run++;
+    }
+    if (n + 4 > cap) return 0;
+    out[n++] = (uint8_t)run;
+    out[n++] = cur[i].r;
+    out[n++] = cur[i].g;
+    out[n++] = cur[i].b;
+    i += run;
+  }
+  return n;
+}
+
+inline size_t flipbookEncodeDelta(const CRGB* prev, const CRGB* cur, int count, uint8_t* out, size_t cap) {
+  size_t n = 0;
+  int i = 0;
+  // Trailing unchanged LEDs need no op at all
+  int end = count;
+  while (end > 0 && prev[end - 1].r == cur[end - 1].r && prev[end - 1].g == cur[end - 1].g &&
+         prev[end - 1].b == cur[end - 1].b) {
+    end--;
+  }
+  while (i < end) {
+    int skip = 0;
+    while (i + skip < end && skip < 255 && prev[i + skip].r == cur[i + skip].r &&
+           prev[i + skip].g == cur[i + skip].g && prev[i + skip].b == cur[i + skip].b) {
+      skip++;
+    }
+    i += skip;
+    int lit = 0;
+    while (i + lit < end && lit < 255 &&
+           (prev[i + lit].r != cur[i + lit].r || prev[i + lit].g != cur[i + lit].g ||
+            prev[i + lit].b != cur[i + lit].b)) {
+      lit++;
+    }
+    if (n + 2 + 3 * lit > cap) return 0;
+    out[n++] = (uint8_t)skip;
+    out[n++] = (uint8_t)lit;
+    for (int k = 0; k < lit; k++, i++) {
+      out[n++] = prev[i].r ^ cur[i].r;
+      out[n++] = prev[i].g ^ cur[i].g;
+      out[n++] = prev[i].b ^ cur[i].b;
+    }
+  }
+  return n;
+}
+
+inline void flipbookWriteHeader(uint8_t* out, int ledCount, int frameCount) {
+  out[0] = 'N';
+  out[1] = 'P';
+  out[2] = 'F';
+  out[3] = 'B';
+  out[4] = 1;
+  out[5] = 0;
+  out[6] = ledCount & 0xFF;
+  out[7] = ledCount >> 8;
+  out[8] = frameCount & 0xFF;
+  out[9] = frameCount >> 8;
+}
+
+inline void flipbookWriteFrameHeader(uint8_t* out, FlipbookFrameType type, int durationMs, size_t payload) {
+  out[0] = type;
+  out[1] = durationMs & 0xFF;
+  out[2] = durationMs >> 8;
+  out[3] = payload & 0xFF;
+  out[4] = payload >> 8;
+}
+
+class FlipbookPlayer {
+ public:
+  // Reads up to n bytes at the current position; returns how many (0 at the end)
+  typedef int (*ReadFn)(void* ctx, uint8_t* buf, int n);
+  // Moves the read position to `offset` from the start of the file
+  typedef bool (*SeekFn)(void* ctx, uint32_t offset);
+
+  static const int kReadBuffer = 64;
+
+  FlipbookPlayer() : read_(nullptr), seek_(nullptr), ctx_(nullptr), ledCount_(0), frames_(0) { rewindState(); }
+
+  // Checks the header and rewinds to frame 0; false if this is not a flipbook
+  bool open(ReadFn read, SeekFn seek, void* ctx) {
+    read_ = read;
+    seek_ = seek;
+    ctx_ = ctx;
+    frames_ = 0;
+    if (!seek_(ctx_, 0)) return false;
+    rewindState();
+    uint8_t h[kFlipbookHeaderBytes];
+    if (!readBytes(h, sizeof(h)) || memcmp(h, "NPFB", 4) != 0 || h[4] != 1) return false;
+    ledCount_ = h[6] | (h[7] << 8);
+    frames_ = h[8] | (h[9] << 8);
+    return frames_ > 0;
+  }
+
+  void close() { frames_ = 0; }
+  bool isOpen() const { return frames_ > 0; }
+  int frameCount() const { return frames_; }
+  int ledCount() const { return ledCount_; }
+
+  // Index of the frame the last nextFrame() decoded, -1 before the first
+  int frameIndex() const { return index_; }
+  // Duration of that frame in ms
+  uint16_t duration() const { return duration_; }
+
+  // Back to before frame 0
+  bool restart() {
+    if (!isOpen() || !seek_(ctx_, kFlipbookHeaderBytes)) return false;
+    rewindState();
+    return true;
+  }
+
+  // Decodes the next frame (after the last one, frame 0 again) into leds[0..count). LEDs
+  // past `count` are consumed but not written. Delta frames apply on top of what leds[]
+  // holds. False if the file is cut short or corrupt; the player is then closed.
+  bool nextFrame(CRGB* leds, int count) {
+    if (!isOpen()) return false;
+    if (index_ + 1 >= frames_ && !restart()) return fail();
+    uint8_t h[kFlipbookFrameHeaderBytes];
+    if (!readBytes(h, sizeof(h))) return fail();
+    uint8_t type = h[0];
+    duration_ = h[1] | (h[2] << 8);
+    int payload = h[3] | (h[4] << 8);
+    if (count > ledCount_) count = ledCount_;
+    if (index_ < 0 && type != FLIPBOOK_KEY) return fail();  // frame 0 has nothing to build on
+    bool ok = type == FLIPBOOK_KEY ? decodeKey(leds, count, payload)
+            : type == FLIPBOOK_DELTA ? decodeDelta(leds, count, payload) : false;
+    if (!ok) return fail();
+    index_++;
+    return true;
+  }
+
+  // Walks every frame header (skipping payloads) and checks the file ends after the last
+  // frame; `size` is the file size. Leaves the player before frame 0.
+  bool validate(uint32_t size) {
+    if (!restart()) return false;
+    uint32_t at = kFlipbookHeaderBytes;
+    for (int f = 0; f < frames_; f++) {
+      uint8_t h[kFlipbookFrameHeaderBytes];
+      if (!seek_(ctx_, at)) return false;
+      bufLen_ = bufPos_ = 0;
+      if (!readBytes(h, sizeof(h)) || h[0] > FLIPBOOK_DELTA || (f == 0 && h[0] != FLIPBOOK_KEY)) return false;
+      at += kFlipbookFrameHeaderBytes + (h[3] | (h[4] << 8));
+      if (at > size) return false;
+    }
+    return at == size && restart();
+  }
+
+ private:
+  void rewindState() {
+    bufLen_ = bufPos_ = 0;
+    index_ = -1;
+    duration_ = 0;
+  }
+
+  bool fail() {
+    frames_ = 0;
+    return false;
+  }
+
+  bool refill() {
+    bufPos_ = 0;
+    bufLen_ = read_(ctx_, buf_, kReadBuffer);
+    return bufLen_ > 0;
+  }
+
+  bool readByte(uint8_t& b) {
+    if (bufPos_ == bufLen_ && !refill()) return false;
+    b = buf_[bufPos_++];
+    return true;
+  }
+
+  bool readBytes(uint8_t* out, int n) {
+    for (int i = 0; i < n; i++) {
+      if (!readByte(out[i])) return false;
+    }
+    return true;
+  }
+
+  bool decodeKey(CRGB* leds, int count, int payload) {
+    int led = 0;
+    for (; payload >= 4; payload -= 4) {
+      uint8_t rec[4];
+      if (!readBytes(rec, 4) || rec[0] == 0) return false;
+      int fit = count - led < rec[0] ? count - led : rec[0];
+      if (fit > 0) fill_solid(leds + led, fit, CRGB(rec[1], rec[2], rec[3]));
+      led += rec[0];
+    }
+    return payload == 0;
+  }
+
+  bool decodeDelta(CRGB* leds, int count, int payload) {
+    int led = 0;
+    while (payload > 0) {
+      uint8_t op[2];
+      if (payload < 2 || !readBytes(op, 2)) return false;
+      payload -= 2;
+      led += op[0];
+      if (payload < 3 * op[1]) return false;
+      payload -= 3 * op[1];
+      for (int k = 0; k < op[1]; k++, led++) {
+        uint8_t x[3];
+        if (!readBytes(x, 3)) return false;
+        if (led < count) {
+          leds[led].r ^= x[0];
+          leds[led].g ^= x[1];
+          leds[led].b ^= x[2];
+        }
+      }
+    }
+    return true;
+  }
+
+  ReadFn read_;
+  SeekFn seek_;
+  void* ctx_;
+  int ledCount_;
+  int frames_;
+  uint8_t buf_[kReadBuffer];
+  int bufLen_;
+  int bufPos_;
+  int index_;
+  uint16_t duration_;
+};
+
+#endif // FLIPBOOK_H
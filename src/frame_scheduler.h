@@ -0,0 +1,134 @@
+#ifndef FRAME_SCHEDULER_H
+#define FRAME_SCHEDULER_H
+
+#include "platform.h"
+
+// Cooperative scheduler for loop(). A frame is render + output, and output is mostly
+// FastLED.show() bit-banging the chain with interrupts off: 30 us per WS2812 LED, ~39 ms for
+// 1296. A fixed 20 ms tick cannot be met at that size, so frames ran back to back and
+// server.handleClient() / ArduinoOTA.handle() only got the gaps.
+//
+// Here the next frame is due at the later of
+//   - its start + 1000 / fps (the pattern's target rate, PatternDesc::fps), and
+//   - its end + kControlReserveUs, so the control plane always gets that much time.
+// A frame's deadline is the slower of the target period and the achievable one (a full
+// chain's wire time + average render + reserve), so a missed deadline means something
+// overran - not just that 50 fps is out of reach for 1296 LEDs. Each task (render, output,
+// HTTP, OTA) is timed against a budget and overruns are counted, for /timing.
+//
+//   if (scheduler.due(micros())) { scheduler.frameStart(micros()); ...; scheduler.frameEnd(micros()); }
+//   scheduler.begin(FrameScheduler::TASK_HTTP, micros()); server.handleClient(); scheduler.end(...);
+//
+// Times are micros() and wrap every ~71 minutes; all comparisons are wrap-safe.
+class FrameScheduler {
+ public:
+  enum Task : uint8_t { TASK_RENDER, TASK_OUTPUT, TASK_HTTP, TASK_OTA, TASK_COUNT };
+
+  static const uint8_t kDefaultFps = 50;
+  static const uint32_t kControlReserveUs = 5000;  // idle time after every frame for HTTP/OTA
+
+  // WS2812 wire time: 24 bits x 1.25 us per LED, then a >= 280 us latch (reset) gap
+  static uint32_t wireMicros(int leds) { return (uint32_t)leds * 30 + 300; }
+
+  struct TaskStats {
+    uint32_t budgetUs;
+    uint32_t lastUs;
+    uint32_t maxUs;
+    uint32_t runs;
+    uint32_t overruns;   // runs longer than budgetUs
+    uint64_t totalUs;
+  };
+
+  FrameScheduler()
+      : fps_(kDefaultFps), chainLeds_(MAX_LEDS), next_(0), scheduled_(0), start_(0), frames_(0), missed_(0) {
+    memset(begun_, 0, sizeof(begun_));
+    memset(tasks_, 0, sizeof(tasks_));
+    tasks_[TASK_RENDER].budgetUs = 10000;
+    tasks_[TASK_OUTPUT].budgetUs = wireMicros(MAX_LEDS);
+    tasks_[TASK_HTTP].budgetUs = 20000;
+    tasks_[TASK_OTA].budgetUs = 20000;
+  }
+
+  // Frames per second the current pattern asks for, 0 = kDefaultFps
+  void setTargetFps(uint8_t fps) { fps_ = fps > 0 ? fps : kDefaultFps; }
+  uint8_t targetFps() const { return fps_; }
+  uint32_t targetPeriodUs() const { return 1000000UL / fps_; }
+
+  // LEDs on the chain (activeLeds), for the achievable period
+  void setChainLeds(int leds) { chainLeds_ = leds; }
+
+  // Output budget for the next frame: the wire time of the LEDs it will send
+  void setOutputLeds(int leds) { tasks_[TASK_OUTPUT].budgetUs = wireMicros(leds) + 1000; }
+
+  // Shortest frame period `leds` LEDs allow: wire time, the average render and the
+  // control-plane reserve. The rate actually reached is the slower of this and the target.
+  uint32_t achievablePeriodUs(int leds) const {
+    const TaskStats& r = tasks_[TASK_RENDER];
+    uint32_t render = r.runs > 0 ? (uint32_t)(r.totalUs / r.runs) : 0;
+    return wireMicros(leds) + render + kControlReserveUs;
+  }
+
+  // Period frames are held to for deadline accounting
+  uint32_t periodUs() const {
+    uint32_t achievable = achievablePeriodUs(chainLeds_);
+    return achievable > targetPeriodUs() ? achievable : targetPeriodUs();
+  }
+
+  bool due(uint32_t nowUs) const { return frames_ == 0 || (int32_t)(nowUs - next_) >= 0; }
+
+  void frameStart(uint32_t nowUs) {
+    // Deadline of this frame: one period after it was due. If the loop was away for longer
+    // than that, the frames that fit in the gap are dropped (and counted as missed) rather
+    // than bunched up.
+    uint32_t late = nowUs - next_;
+    scheduled_ = next_;
+    if (frames_ > 0 && (int32_t)late > (int32_t)periodUs()) {
+      missed_ += late / periodUs();
+      scheduled_ = nowUs;
+    }
+    start_ = nowUs;
+  }
+
+  void frameEnd(uint32_t nowUs) {
+    frames_++;
+    uint32_t deadline = scheduled_ + periodUs();
+    if ((int32_t)(nowUs - deadline) > 0) missed_++;
+    uint32_t byTarget = start_ + targetPeriodUs();
+    uint32_t byReserve = nowUs + kControlReserveUs;
+    next_ = ((int32_t)(byReserve - byTarget) > 0) ? byReserve : byTarget;
+  }
+
+  void begin(Task t, uint32_t nowUs) { begun_[t] = nowUs; }
+
+  void end(Task t, uint32_t nowUs) {
+    TaskStats& s = tasks_[t];
+    uint32_t us = nowUs - begun_[t];
+    s.lastUs = us;
+    if (us > s.maxUs) s.maxUs = us;
+    s.runs++;
+    s.totalUs += us;
+    if (us > s.budgetUs) s.overruns++;
+  }
+
+  const TaskStats& task(Task t) const { return tasks_[t]; }
+  uint32_t frames() const { return frames_; }
+  uint32_t missed() const { return missed_; }   // frames that ended late or were dropped
+
+  static const char* taskName(Task t) {
+    static const char* const kNames[TASK_COUNT] = { "render", "output", "http", "ota" };
+    return kNames[t];
+  }
+
+ private:
+  uint8_t fps_;
+  int chainLeds_;
+  uint32_t next_;       // when the next frame may start
+  uint32_t scheduled_;  // when the current frame was due
+  uint32_t start_;
+  uint32_t frames_;
+  uint32_t missed_;
+  uint32_t begun_[TASK_COUNT];
+  TaskStats tasks_[TASK_COUNT];
+};
+
+#endif // FRAME_SCHEDULER_H
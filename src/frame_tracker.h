@@ -0,0 +1,83 @@
+#ifndef FRAME_TRACKER_H
+#define FRAME_TRACKER_H
+
+#include "platform.h"
+
+// Works out how much of the LED chain has to be clocked out for the strip to show the
+// current buffer. WS2812 pixels keep their latched color when the data stream stops early,
+// so a frame only needs to be sent up to its last changed LED - and not at all when nothing
+// changed (solid colors, Off, an uploaded designer frame). A full 1296-LED show() is ~39 ms
+// of interrupts-off bit-banging, so this is most of the loop() budget on static or
+// head-only scenes (test card, short activeLeds, sparse uploads).
+//
+//   outputStage.apply(leds, frame, activeLeds);
+//   int n = frameTracker.pending(leds, MAX_LEDS);
+//   if (outputStage.limitChanged()) n = MAX_LEDS;
+//   if (n > 0) { FastLED[0].setLeds(frame, n); FastLED.show(); ... }
+//
+// Changes are found per block of kBlockLeds by comparing block hashes with what was last
+// sent. Call invalidate() after anything that writes the strip behind the tracker's back
+// (a direct FastLED.show(), brightness change, ...), so the next frame is sent in full.
+class FrameTracker {
+ public:
+  static const int kBlockLeds = 16;
+  static const int kMaxBlocks = (MAX_LEDS + kBlockLeds - 1) / kBlockLeds;
+  // Send the whole chain at least this often, in case a show() was corrupted on the wire.
+  static const unsigned long kRefreshMs = 2000;
+
+  FrameTracker() : valid_(false), lastFull_(0), skipped_(0) {}
+
+  // Number of LEDs, from index 0, to send so the strip matches leds[0..count): 0 when it
+  // already does, `count` for the first frame and every kRefreshMs. Assumes the caller
+  // sends exactly that many.
+  int pending(const CRGB* leds, int count) {
+    if (count > kMaxBlocks * kBlockLeds) count = kMaxBlocks * kBlockLeds;
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(leds);
+    int dirtyEnd = 0;
+    for (int start = 0, b = 0; start < count; start += kBlockLeds, b++) {
+      int n = (count - start < kBlockLeds) ? (count - start) : kBlockLeds;
+      uint32_t h = hash(bytes + start * 3, n * 3);
+      if (h != sent_[b]) {
+        sent_[b] = h;
+        dirtyEnd = start + n;
+      }
+    }
+
+    unsigned long now = millis();
+    if (!valid_ || now - lastFull_ >= kRefreshMs) {
+      valid_ = true;
+      lastFull_ = now;
+      return count;
+    }
+    if (dirtyEnd == 0) skipped_++;
+    return dirtyEnd;
+  }
+
+  void invalidate() { valid_ = false; }
+
+  // Frames skipped entirely since boot
+  uint32_t skipped() const { return skipped_; }
+
+  // FNV-1a over 32-bit words
+  static uint32_t hash(const uint8_t* data, int len) {
+    uint32_t h = 2166136261u;
+    int i = 0;
+    for (; i + 4 <= len; i += 4) {
+      uint32_t w;
+      memcpy(&w, data + i, 4);
+      h = (h ^ w) * 16777619u;
+    }
+    for (; i < len; i++) {
+      h = (h ^ data[i]) * 16777619u;
+    }
+    return h;
+  }
+
+ private:
+  uint32_t sent_[kMaxBlocks];  // hash of each block as last sent
+  bool valid_;
+  unsigned long lastFull_;
+  uint32_t skipped_;
+};
+
+#endif // FRAME_TRACKER_H
@@ -0,0 +1,140 @@
+#ifndef FRAME_UPLOAD_H
+#define FRAME_UPLOAD_H
+
+#include "platform.h"
+
+// Decodes a binary frame upload chunk by chunk, straight into an LED buffer. The web server
+// hands the body over in blocks of at most HTTP_RAW_BUFLEN bytes, so an upload of any size
+// needs no more memory than this object (a record split across two blocks is carried in
+// pending_). /uploadPattern streams its JSON the same way, through SparseJsonParser.
+//
+//   upload.begin(customPattern, MAX_LEDS, FrameUpload::FORMAT_RLE, 0);
+//   upload.feed(raw.buf, raw.currentSize);   // for every block
+//   if (upload.finish()) ...
+//
+// Formats (indices are strip indices, as in the JSON sparse list):
+//   FORMAT_RGB      r,g,b per LED, from index `start` on
+//   FORMAT_INDEXED  records of index (uint16 little endian), r, g, b
+//   FORMAT_RLE      records of count (1..255), r, g, b: `count` LEDs of that color, from
+//                   index `start` on
+// begin() clears the buffer to black, so LEDs the upload does not mention are off.
+// Pixels past the end of the buffer are dropped and counted.
+class FrameUpload {
+ public:
+  enum Format : uint8_t { FORMAT_RGB, FORMAT_INDEXED, FORMAT_RLE, FORMAT_COUNT };
+
+  struct Stats {
+    uint32_t bytes;    // body bytes fed
+    uint32_t chunks;   // feed() calls
+    uint32_t pixels;   // LEDs written
+    uint32_t dropped;  // LEDs / records outside the buffer
+  };
+
+  FrameUpload() : dest_(nullptr), count_(0), format_(FORMAT_RGB), next_(0), pendingLen_(0) {
+    memset(&stats_, 0, sizeof(stats_));
+  }
+
+  static const char* formatName(Format f) {
+    static const char* const kNames[FORMAT_COUNT] = { "rgb", "idx", "rle" };
+    return kNames[f];
+  }
+
+  // Format by name ("rgb", "idx", "rle"); FORMAT_COUNT if unknown
+  static Format parseFormat(const char* name) {
+    for (int f = 0; f < FORMAT_COUNT; f++) {
+      if (strcmp(name, formatName((Format)f)) == 0) return (Format)f;
+    }
+    return FORMAT_COUNT;
+  }
+
+  static int recordSize(Format f) { return f == FORMAT_INDEXED ? 5 : f == FORMAT_RLE ? 4 : 3; }
+
+  void begin(CRGB* dest, int count, Format format, int start) {
+    dest_ = dest;
+    count_ = count;
+    format_ = format;
+    next_ = start > 0 ? start : 0;
+    pendingLen_ = 0;
+    memset(&stats_, 0, sizeof(stats_));
+    fill_solid(dest_, count_, CRGB::Black);
+  }
+
+  void feed(const uint8_t* data, size_t len) {
+    stats_.bytes += len;
+    stats_.chunks++;
+    const int size = recordSize(format_);
+    // Complete the record split at the end of the previous chunk
+    if (pendingLen_ > 0) {
+      while (pendingLen_ < size && len > 0) {
+        pending_[pendingLen_++] = *data++;
+        len--;
+      }
+      if (pendingLen_ < size) return;
+      apply(pending_);
+      pendingLen_ = 0;
+    }
+    if (format_ == FORMAT_RGB) {
+      // Whole pixels go in with one copy
+      size_t n = len / 3;
+      int room = count_ > next_ ? count_ - next_ : 0;
+      size_t fit = n < (size_t)room ? n : (size_t)room;
+      memcpy(reinterpret_cast<uint8_t*>(dest_ + next_), data, fit * 3);
+      next_ += fit;
+      stats_.pixels += fit;
+      stats_.dropped += n - fit;
+      data += n * 3;
+      len -= n * 3;
+    } else {
+      for (; len >= (size_t)size; data += size, len -= size) apply(data);
+    }
+    memcpy(pending_, data, len);
+    pendingLen_ = len;
+  }
+
+  // True if the body ended on a record boundary
+  bool finish() const { return pendingLen_ == 0; }
+
+  const Stats& stats() const { return stats_; }
+  Format format() const { return format_; }
+
+ private:
+  void apply(const uint8_t* rec) {
+    switch (format_) {
+      case FORMAT_RGB:
+        put(next_++, rec);
+        break;
+      case FORMAT_INDEXED:
+        put(rec[0] | (rec[1] << 8), rec + 2);
+        break;
+      default: {
+        int n = rec[0];
+        int room = count_ > next_ ? count_ - next_ : 0;
+        int fit = n < room ? n : room;
+        if (fit > 0) fill_solid(dest_ + next_, fit, CRGB(rec[1], rec[2], rec[3]));
+        next_ += n;
+        stats_.pixels += fit;
+        stats_.dropped += n - fit;
+        break;
+      }
+    }
+  }
+
+  void put(int index, const uint8_t* rgb) {
+    if (index < count_) {
+      dest_[index] = CRGB(rgb[0], rgb[1], rgb[2]);
+      stats_.pixels++;
+    } else {
+      stats_.dropped++;
+    }
+  }
+
+  CRGB* dest_;
+  int count_;
+  Format format_;
+  int next_;           // next LED for FORMAT_RGB / FORMAT_RLE
+  uint8_t pending_[5];
+  int pendingLen_;
+  Stats stats_;
+};
+
+#endif // FRAME_UPLOAD_H
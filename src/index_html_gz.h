@@ -0,0 +1,183 @@
+// Generated by scripts/build_web_page.py from web/device/index.html - do not edit;
+// `make web-page` regenerates it.
+#ifndef INDEX_HTML_GZ_H
+#define INDEX_HTML_GZ_H
+
+#include "platform.h"
+
+// 7784 bytes of HTML, 2698 gzipped
+static const char kIndexHtmlEtag[] = "\"588a6c1df62bca76\"";
+static const size_t kIndexHtmlGzLength = 2698;
+static const uint8_t kIndexHtmlGz[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xa5, 0x59, 0x7b, 0x6f, 0x1b, 0xb9,
+  0x11, 0xff, 0x3f, 0x9f, 0x82, 0xd9, 0xa0, 0x91, 0x74, 0xd6, 0xd3, 0x8f, 0xab, 0x63, 0x3d, 0x82,
+  0xc4, 0xf6, 0xf5, 0x52, 0xa4, 0xce, 0x21, 0xf6, 0x15, 0x68, 0x53, 0xa3, 0xa0, 0x76, 0x29, 0x89,
+  0xcd, 0xee, 0x72, 0x4b, 0x52, 0x76, 0x7c, 0x81, 0x3f, 0xc7, 0x7d, 0xa0, 0xfb, 0x62, 0x9d, 0x19,
+  0x72, 0x57, 0x5c, 0x3d, 0x6c, 0x27, 0x0d, 0x02, 0x88, 0x4b, 0x0e, 0x7f, 0x33, 0x1c, 0xce, 0xfc,
+  0x38, 0xa4, 0x47, 0xcf, 0xcf, 0x3e, 0x9c, 0x5e, 0xfd, 0xe3, 0x97, 0x73, 0xb6, 0xb0, 0x59, 0x3a,
+  0x79, 0x36, 0x2a, 0x7f, 0x04, 0x4f, 0x26, 0xcf, 0x18, 0x1b, 0x65, 0xc2, 0x72, 0x96, 0xf3, 0x4c,
+  0x8c, 0xa3, 0x1b, 0x29, 0x6e, 0x0b, 0xa5, 0x6d, 0xc4, 0x62, 0x95, 0x5b, 0x91, 0xdb, 0x71, 0x74,
+  0x2b, 0x13, 0xbb, 0x18, 0x27, 0xe2, 0x46, 0xc6, 0xa2, 0x43, 0x1f, 0x6d, 0x26, 0x73, 0x69, 0x25,
+  0x4f, 0x3b, 0x26, 0xe6, 0xa9, 0x18, 0x0f, 0x22, 0x82, 0x31, 0xf6, 0x2e, 0x15, 0xd8, 0x62, 0x6c,
+  0xaa, 0x92, 0x3b, 0xf6, 0x95, 0xcd, 0x00, 0xa3, 0x33, 0xe3, 0x99, 0x4c, 0xef, 0x4e, 0x98, 0xe1,
+  0xb9, 0xe9, 0x18, 0xa1, 0xe5, 0x6c, 0xc8, 0xac, 0xf8, 0x62, 0x3b, 0x3c, 0x95, 0xf3, 0xfc, 0x84,
+  0xc5, 0xa0, 0x45, 0xe8, 0x21, 0x2b, 0x78, 0x92, 0xc8, 0x7c, 0x7e, 0xc2, 0xf6, 0xfb, 0xc5, 0x97,
+  0x21, 0x9b, 0xf2, 0xf8, 0xf3, 0x5c, 0xab, 0x65, 0x9e, 0x9c, 0xb0, 0x17, 0xfb, 0xfb, 0xfb, 0x43,
+  0xb0, 0x28, 0x55, 0x1a, 0x3e, 0x66, 0x33, 0x40, 0xb8, 0x77, 0x7a, 0x96, 0xd6, 0xaa, 0x1c, 0x34,
+  0x25, 0xd2, 0x14, 0x29, 0x07, 0x2d, 0xd3, 0x54, 0xc5, 0x9f, 0x87, 0x8c, 0xec, 0x3c, 0x61, 0x83,
+  0x7e, 0xff, 0x4f, 0x01, 0xf2, 0xe0, 0x08, 0x91, 0x33, 0xae, 0xe7, 0x32, 0xc7, 0xc1, 0xe2, 0x0b,
+  0xeb, 0x0f, 0x9d, 0x95, 0x46, 0xfe, 0x26, 0xa0, 0xeb, 0x98, 0x54, 0x2b, 0x9d, 0x08, 0xd0, 0x94,
+  0xab, 0x5c, 0x94, 0x5f, 0x1d, 0xcd, 0x13, 0xb9, 0x34, 0x27, 0x8c, 0x20, 0xe2, 0xa5, 0x36, 0x68,
+  0x4b, 0xa1, 0xa4, 0x33, 0xde, 0x99, 0x23, 0xf3, 0x62, 0x69, 0xc1, 0x9a, 0x95, 0x42, 0x5a, 0x4a,
+  0xa8, 0xe0, 0x47, 0xec, 0xf0, 0xd6, 0xfd, 0x48, 0xa3, 0xdb, 0x7c, 0xe1, 0xe0, 0x8c, 0x48, 0x45,
+  0xfc, 0x14, 0x3c, 0x27, 0xde, 0xc5, 0x2d, 0xd3, 0x2a, 0xed, 0xa0, 0xdb, 0x0a, 0x98, 0x56, 0x2e,
+  0x74, 0xdf, 0x2f, 0x74, 0xcd, 0x0f, 0x35, 0x0f, 0x1f, 0x1c, 0x1c, 0x6c, 0x2c, 0xd5, 0x69, 0xf3,
+  0xe0, 0x9a, 0xcb, 0x7c, 0xaa, 0x6e, 0x01, 0x36, 0x9c, 0x97, 0xca, 0x5c, 0x70, 0x0d, 0x1a, 0x61,
+  0x0a, 0xd8, 0xde, 0x7c, 0xd5, 0x4f, 0xc4, 0xbc, 0xcd, 0xb4, 0x48, 0xda, 0x4c, 0x69, 0x9e, 0xcf,
+  0x45, 0x9b, 0xdd, 0x89, 0x34, 0x55, 0xb7, 0x6d, 0x36, 0xd7, 0x42, 0xe4, 0x6d, 0xd8, 0xa1, 0xa5,
+  0xc0, 0x08, 0x4a, 0xe4, 0x5c, 0xb5, 0xd9, 0x8d, 0x54, 0xa9, 0xb0, 0xad, 0x6a, 0x77, 0xa7, 0x29,
+  0xc7, 0xfd, 0x2b, 0x95, 0x8a, 0xa4, 0xa6, 0xb0, 0xb3, 0x8a, 0x81, 0x43, 0xf8, 0x57, 0xcd, 0xba,
+  0x5d, 0x48, 0x2b, 0xaa, 0x59, 0xa4, 0x68, 0xfb, 0xbc, 0xc3, 0x43, 0x9c, 0xb9, 0x43, 0x1b, 0x5a,
+  0xb6, 0x6b, 0x1a, 0x4e, 0xdc, 0xa1, 0x2e, 0x56, 0x2a, 0x7d, 0xc4, 0x2d, 0x87, 0x47, 0xe4, 0x16,
+  0x30, 0xbb, 0xdf, 0x8f, 0xe3, 0x36, 0xb9, 0xfb, 0x60, 0x36, 0x6b, 0xed, 0x40, 0x9c, 0x49, 0x2d,
+  0x1e, 0x41, 0xb4, 0x8a, 0x69, 0x39, 0x5f, 0x58, 0x0f, 0xda, 0xef, 0x53, 0x03, 0x9b, 0xbb, 0x7c,
+  0x69, 0x0a, 0x11, 0x43, 0xce, 0x3e, 0x1d, 0xb7, 0xdf, 0x47, 0x40, 0xaf, 0x20, 0x34, 0xb6, 0x8e,
+  0xab, 0x66, 0xb3, 0xed, 0x4e, 0x3b, 0x3a, 0x3a, 0xda, 0xe5, 0xb1, 0xa5, 0xd6, 0xa0, 0x0c, 0xa6,
+  0xa9, 0xa5, 0x45, 0x0b, 0x4e, 0xd8, 0x01, 0x84, 0xa8, 0x51, 0xa9, 0x4c, 0x7c, 0x7e, 0xfb, 0x81,
+  0x0e, 0xa0, 0x1b, 0x61, 0x21, 0x86, 0x57, 0xa1, 0xf8, 0xa2, 0x10, 0x1a, 0x55, 0x96, 0x7a, 0x8e,
+  0x8f, 0x8f, 0xeb, 0x39, 0x71, 0xe0, 0x64, 0x49, 0xb8, 0xf7, 0x03, 0xbb, 0xe2, 0x53, 0x46, 0xdc,
+  0x64, 0xd8, 0x0f, 0x3d, 0x67, 0x80, 0xe5, 0x53, 0x13, 0xb2, 0xc6, 0x2c, 0x15, 0x01, 0x31, 0x94,
+  0xf9, 0xe2, 0xd3, 0x61, 0xaa, 0x80, 0x64, 0x32, 0x32, 0xa1, 0x34, 0x91, 0x62, 0xef, 0xbe, 0xc2,
+  0x42, 0xaa, 0x03, 0x04, 0x50, 0xfd, 0xe4, 0x24, 0x2b, 0xd9, 0xa5, 0x5c, 0x04, 0xe7, 0x7c, 0x0b,
+  0xad, 0xec, 0xca, 0x74, 0xd0, 0xd9, 0xe5, 0xb1, 0x95, 0x37, 0xeb, 0x61, 0xf2, 0x22, 0xcc, 0x0a,
+  0xe7, 0xc9, 0xb5, 0x55, 0x04, 0x8e, 0x76, 0x1b, 0x1c, 0x82, 0x76, 0x3c, 0xeb, 0x87, 0xbe, 0x71,
+  0x76, 0x6e, 0xca, 0xac, 0x0c, 0x58, 0x27, 0x5f, 0x94, 0x1d, 0xf5, 0xaa, 0xe3, 0x60, 0x64, 0x62,
+  0x2d, 0x0b, 0xeb, 0x4e, 0x86, 0xd9, 0x32, 0x87, 0x69, 0xc0, 0xd9, 0xb0, 0xab, 0x7f, 0x53, 0x89,
+  0x68, 0x66, 0x2d, 0xf6, 0x95, 0x46, 0x60, 0x4c, 0xd8, 0x78, 0xd1, 0x6c, 0xf4, 0x60, 0xe8, 0x75,
+  0x36, 0x6e, 0xb0, 0x3d, 0x96, 0xb5, 0x86, 0x34, 0x76, 0xbf, 0x36, 0x77, 0xa1, 0x6e, 0x61, 0x57,
+  0x9b, 0x60, 0xcd, 0x05, 0x1c, 0x5b, 0x2b, 0x84, 0x1b, 0xae, 0x19, 0xed, 0xed, 0x98, 0x25, 0x2a,
+  0x5e, 0x66, 0x68, 0xe6, 0x5c, 0xd8, 0xf3, 0x54, 0x60, 0xd3, 0xbc, 0xbd, 0x3b, 0x4d, 0xb9, 0x31,
+  0x38, 0xa7, 0xd9, 0x08, 0x96, 0xd2, 0xf0, 0x6a, 0x40, 0x85, 0xd2, 0xac, 0x89, 0x28, 0x12, 0x20,
+  0x20, 0x04, 0x24, 0x1b, 0x11, 0x60, 0x37, 0x15, 0xf9, 0xdc, 0x2e, 0xa0, 0x63, 0x6f, 0x6f, 0xa5,
+  0x8e, 0xd1, 0xd8, 0x27, 0x79, 0xdd, 0x8d, 0x11, 0xf7, 0xbd, 0x34, 0x16, 0x28, 0x2b, 0x53, 0x37,
+  0x00, 0xef, 0xbc, 0xb3, 0x42, 0xbe, 0xaf, 0x9b, 0xf8, 0x96, 0x4e, 0xae, 0xa7, 0x1a, 0xfa, 0xa8,
+  0x81, 0x1e, 0xee, 0x01, 0x33, 0xbd, 0xc4, 0xb7, 0x19, 0xbb, 0xc5, 0xb6, 0xb7, 0x77, 0xef, 0x92,
+  0xca, 0xf1, 0x01, 0x14, 0x84, 0xfd, 0x26, 0x8e, 0xb8, 0xc1, 0xc9, 0x16, 0xf2, 0x4a, 0xd8, 0x87,
+  0x65, 0x7d, 0xcc, 0xf8, 0x48, 0x19, 0xf5, 0x5c, 0x71, 0x32, 0xc2, 0x42, 0x82, 0x62, 0x68, 0x31,
+  0x98, 0xbc, 0x3f, 0x3f, 0x63, 0xa7, 0xee, 0x88, 0x63, 0xcd, 0x57, 0x7f, 0xfc, 0x3e, 0x38, 0x3c,
+  0x64, 0x7f, 0xd1, 0x32, 0x69, 0x81, 0xf4, 0x80, 0x84, 0x12, 0x79, 0xc3, 0x64, 0x32, 0x8e, 0x90,
+  0x20, 0xa2, 0xc9, 0xa8, 0x07, 0xdf, 0x93, 0x67, 0xe5, 0x00, 0xa9, 0x1f, 0x47, 0xb5, 0x43, 0x32,
+  0x72, 0x41, 0x39, 0x4a, 0xf9, 0x54, 0xa4, 0x93, 0x8b, 0x65, 0x36, 0x15, 0x9a, 0xa9, 0x19, 0x03,
+  0x55, 0xe6, 0x64, 0xd4, 0x73, 0xdd, 0x4e, 0x04, 0x1c, 0x9f, 0x31, 0x4e, 0xf1, 0x37, 0x8e, 0x30,
+  0x44, 0x23, 0x06, 0x75, 0xd3, 0x42, 0x81, 0xba, 0x39, 0x7e, 0x50, 0xb8, 0x8f, 0xa3, 0x32, 0x17,
+  0x64, 0x8e, 0xf4, 0x35, 0x8c, 0xaa, 0x2d, 0x60, 0x0c, 0xbc, 0xbf, 0x9c, 0x66, 0x12, 0x4a, 0xaa,
+  0x30, 0xd0, 0x63, 0x0a, 0x74, 0xbb, 0x90, 0xa6, 0x1b, 0x77, 0x6f, 0x38, 0x1c, 0x41, 0x40, 0xb4,
+  0x5a, 0xd8, 0xa5, 0xce, 0xd9, 0x8c, 0xa7, 0x06, 0x30, 0x26, 0x1e, 0x64, 0xe4, 0xea, 0x0b, 0x7b,
+  0x57, 0x80, 0xa2, 0x9c, 0x8c, 0x8d, 0x7c, 0xdd, 0x16, 0x47, 0xb4, 0x70, 0xf8, 0xc9, 0x24, 0xd8,
+  0x37, 0x80, 0x5f, 0xfe, 0x05, 0x7e, 0x8f, 0xfa, 0xfd, 0x88, 0x11, 0xea, 0x38, 0x5a, 0xe1, 0xf8,
+  0xb2, 0xc9, 0x01, 0x39, 0xa3, 0x76, 0x2d, 0xc0, 0xd7, 0x2a, 0x7c, 0x69, 0xd5, 0x70, 0xad, 0x0e,
+  0x89, 0x26, 0x97, 0xc2, 0x8e, 0x7a, 0x0e, 0xcc, 0x7b, 0xa9, 0x87, 0x6e, 0xa2, 0xbd, 0xf8, 0x56,
+  0xe7, 0x9f, 0x22, 0x67, 0xad, 0x3b, 0xdd, 0x57, 0x40, 0xb4, 0xa7, 0x50, 0x69, 0x5a, 0x2b, 0x22,
+  0x70, 0x63, 0xbc, 0xc0, 0xc2, 0xa2, 0xee, 0x46, 0x3f, 0xbc, 0x72, 0xa6, 0x73, 0x25, 0x46, 0x81,
+  0x03, 0xd9, 0x6d, 0x14, 0xe6, 0x70, 0x69, 0x8b, 0xf7, 0xcc, 0x6a, 0x84, 0xb9, 0x30, 0x25, 0xb5,
+  0xa9, 0x8c, 0x3f, 0x83, 0xbf, 0x3c, 0xf9, 0x10, 0x81, 0x0c, 0x92, 0x06, 0xe8, 0x18, 0x9c, 0xb1,
+  0x5f, 0x38, 0x68, 0xd7, 0xb9, 0x59, 0xf3, 0xc7, 0x06, 0xde, 0x2e, 0xa0, 0x7d, 0x02, 0xda, 0x3f,
+  0xa3, 0x88, 0xfe, 0xbf, 0xd1, 0xb0, 0xa6, 0x44, 0xbc, 0xcb, 0x18, 0xbc, 0x0d, 0xfb, 0x38, 0x67,
+  0x57, 0xd0, 0xf3, 0xbd, 0x68, 0x53, 0x6e, 0x64, 0x8c, 0x70, 0x6f, 0xb1, 0x11, 0xa2, 0x04, 0x0e,
+  0x7d, 0xde, 0xe9, 0xb0, 0xba, 0x3a, 0x3a, 0x78, 0x3b, 0x9d, 0x5a, 0x66, 0x96, 0xc6, 0x45, 0x81,
+  0xda, 0x92, 0x85, 0xcb, 0x3d, 0x58, 0xec, 0x6f, 0xd8, 0x0d, 0x5d, 0x6e, 0xec, 0x91, 0x58, 0xaa,
+  0xa2, 0xe9, 0x1c, 0xcf, 0x4f, 0x2a, 0xad, 0x19, 0x54, 0x34, 0x86, 0xe0, 0xea, 0xb1, 0xb5, 0x2d,
+  0xa5, 0xaf, 0xc8, 0xb2, 0x6d, 0x69, 0xed, 0x4a, 0x83, 0x8e, 0x55, 0x45, 0x19, 0xfc, 0x41, 0x3a,
+  0xfb, 0x6c, 0x35, 0x22, 0x4f, 0x10, 0xa1, 0x89, 0xf1, 0xd7, 0x5a, 0xa5, 0xed, 0x5a, 0xe2, 0x2e,
+  0x64, 0x92, 0x88, 0xbc, 0x4c, 0x5c, 0xa8, 0x70, 0xa1, 0xd8, 0x8b, 0x6d, 0x95, 0xa5, 0x83, 0x5d,
+  0xf3, 0x9c, 0xdb, 0xdc, 0x2c, 0xd7, 0x26, 0x87, 0x52, 0xcb, 0x5b, 0xe9, 0xef, 0x15, 0xc7, 0xf5,
+  0x4b, 0xcf, 0xd6, 0x3b, 0x03, 0x11, 0x84, 0x3b, 0x2d, 0x40, 0x27, 0xb0, 0xc4, 0xe4, 0xd9, 0x4a,
+  0x2d, 0x7a, 0x79, 0xdb, 0xc2, 0x8f, 0x28, 0xeb, 0x03, 0x4a, 0xf3, 0xde, 0x76, 0xdb, 0xc5, 0x2e,
+  0x0b, 0x21, 0xa0, 0x06, 0x19, 0x99, 0x82, 0xe7, 0x64, 0x9c, 0xc1, 0x8e, 0x33, 0x47, 0x28, 0x94,
+  0x89, 0x30, 0x30, 0x61, 0x99, 0x29, 0x37, 0x62, 0x34, 0xd5, 0x35, 0xb4, 0x70, 0xb9, 0x74, 0x79,
+  0x28, 0xd7, 0x4b, 0x40, 0xd1, 0x0a, 0xf3, 0x12, 0xea, 0x17, 0x24, 0x3f, 0x22, 0xbb, 0xfd, 0xbe,
+  0x67, 0xbb, 0x7d, 0x24, 0xbb, 0x4d, 0x57, 0x84, 0x1c, 0x5c, 0x51, 0x31, 0xa9, 0x02, 0xb6, 0xdb,
+  0x71, 0xc0, 0x35, 0x42, 0xd3, 0x1b, 0xad, 0x2e, 0xba, 0xf9, 0xd4, 0xd7, 0x46, 0xe3, 0x80, 0x60,
+  0xea, 0xde, 0x58, 0x5b, 0x8e, 0xc9, 0x38, 0x78, 0xc5, 0x1b, 0x14, 0x56, 0xab, 0xd1, 0xe4, 0xbd,
+  0xba, 0x85, 0xf8, 0x1c, 0xb3, 0x9f, 0xb8, 0x81, 0x40, 0x6d, 0xb3, 0x9f, 0xa1, 0xe6, 0xa6, 0x8e,
+  0xcb, 0x14, 0x47, 0xc0, 0x55, 0x38, 0x37, 0x88, 0x84, 0x2a, 0xd1, 0x9e, 0x40, 0xe1, 0xb5, 0xcb,
+  0xef, 0x66, 0xe4, 0x4e, 0x7e, 0x2d, 0x12, 0x6e, 0x85, 0xcb, 0xd1, 0x97, 0xec, 0x12, 0x8e, 0x67,
+  0xbb, 0x4a, 0xdd, 0x3a, 0x49, 0x84, 0x94, 0x5e, 0x59, 0x41, 0xcd, 0x62, 0x7d, 0x61, 0x54, 0xc1,
+  0x86, 0x61, 0x76, 0xe8, 0xce, 0x88, 0x65, 0x81, 0x0f, 0x0a, 0x70, 0x9d, 0x7c, 0xd3, 0xf9, 0x67,
+  0x9b, 0xf5, 0x3b, 0xaf, 0xda, 0x0c, 0xe2, 0x20, 0x86, 0x3b, 0xe0, 0xf3, 0x36, 0xeb, 0xb6, 0x59,
+  0x67, 0xd4, 0x2b, 0xb6, 0x70, 0xc9, 0x3a, 0x15, 0xee, 0x62, 0x93, 0xfd, 0xe4, 0x11, 0x2e, 0xd9,
+  0x00, 0x6a, 0x0e, 0x32, 0xf6, 0xc7, 0xef, 0xec, 0xf0, 0x28, 0xce, 0x5a, 0x25, 0xb5, 0xac, 0x29,
+  0x0f, 0x08, 0x7d, 0x97, 0xde, 0xc1, 0x56, 0xbd, 0xe5, 0x71, 0xb1, 0x05, 0x93, 0xc8, 0xb3, 0x2c,
+  0x60, 0x76, 0xc2, 0x12, 0xd7, 0x3e, 0xb2, 0xa2, 0x3a, 0xd2, 0x96, 0x25, 0x84, 0x05, 0x77, 0xaf,
+  0x57, 0x2e, 0xc5, 0xbf, 0x96, 0x18, 0xb8, 0x1e, 0x64, 0x82, 0xcd, 0xb4, 0xca, 0x20, 0x90, 0xa1,
+  0x21, 0x75, 0x76, 0xcb, 0xb5, 0x68, 0x18, 0xe0, 0x0c, 0x27, 0xa8, 0xc5, 0x1c, 0xca, 0x34, 0x0d,
+  0x15, 0xfd, 0xa7, 0x4f, 0x12, 0x6e, 0xf2, 0x98, 0x84, 0x6d, 0xb7, 0xdf, 0x6d, 0xb8, 0xe9, 0xf0,
+  0xb9, 0xb9, 0x86, 0xad, 0xeb, 0x76, 0xaf, 0xeb, 0x65, 0x39, 0x30, 0x8e, 0x57, 0xe5, 0x8b, 0xcd,
+  0x66, 0x0a, 0x30, 0x41, 0x7d, 0xbf, 0xa5, 0x76, 0x45, 0x89, 0x5d, 0x55, 0x2b, 0x89, 0x26, 0x20,
+  0x8b, 0x42, 0x50, 0xb8, 0x7e, 0xea, 0x5f, 0x3b, 0x5b, 0x82, 0xae, 0xc1, 0xb5, 0x37, 0x2c, 0xe8,
+  0xdb, 0xbf, 0xf6, 0x56, 0x06, 0x7d, 0x07, 0xd7, 0xc3, 0x0a, 0x57, 0xce, 0x58, 0xd3, 0x8d, 0xbf,
+  0x64, 0xc7, 0x2d, 0x7a, 0xe9, 0x92, 0xf9, 0x12, 0x6a, 0x1d, 0x72, 0xd6, 0x9b, 0xab, 0xab, 0xf3,
+  0x8f, 0x17, 0xff, 0xfe, 0xf9, 0xdd, 0xd9, 0xd9, 0xf9, 0x45, 0xcd, 0x16, 0x2c, 0x07, 0xc6, 0xab,
+  0xa9, 0x87, 0x2d, 0xf6, 0x9a, 0x05, 0x07, 0x24, 0x3b, 0x59, 0x8d, 0x0d, 0xaa, 0x31, 0x38, 0xd8,
+  0x61, 0xa0, 0x2c, 0x16, 0x86, 0x35, 0xc0, 0xa9, 0xcd, 0xc3, 0x0b, 0x40, 0xac, 0x05, 0xe4, 0xa5,
+  0xa7, 0xa1, 0x66, 0xc3, 0x6d, 0xd7, 0xaa, 0x98, 0x66, 0x28, 0xef, 0xaa, 0xe8, 0x0b, 0xe7, 0x04,
+  0x5a, 0x78, 0x7d, 0xb8, 0x4e, 0x54, 0xe8, 0xac, 0xfa, 0xb8, 0x3f, 0xe1, 0x69, 0x1d, 0x7e, 0xdf,
+  0xe8, 0x0a, 0x56, 0x95, 0x9c, 0x65, 0x27, 0xf6, 0xad, 0xee, 0x68, 0x70, 0xa9, 0x83, 0xff, 0xad,
+  0x26, 0x54, 0xdb, 0x75, 0x3c, 0x10, 0x79, 0x63, 0xad, 0x96, 0x60, 0x2c, 0xdc, 0x23, 0x80, 0x57,
+  0x78, 0xc7, 0x47, 0x51, 0xa3, 0xcd, 0x6a, 0xd2, 0x0f, 0xdc, 0x25, 0x5a, 0x5d, 0x5e, 0x14, 0x70,
+  0x7a, 0x9e, 0x2e, 0x64, 0x9a, 0x34, 0x01, 0x76, 0xe3, 0x22, 0x82, 0x5b, 0x06, 0x0b, 0xb7, 0x40,
+  0x56, 0x16, 0xee, 0x7b, 0x58, 0x9e, 0x50, 0x33, 0xe8, 0xac, 0xdd, 0x14, 0x7d, 0x65, 0xe8, 0x4d,
+  0x31, 0xc8, 0xe0, 0x0b, 0x91, 0xaf, 0x96, 0xac, 0x83, 0x25, 0xeb, 0xee, 0x7f, 0x0c, 0x2e, 0x18,
+  0x17, 0xe8, 0xc4, 0x36, 0x02, 0x19, 0xc0, 0xcb, 0x64, 0xa2, 0x3a, 0x15, 0x2a, 0x8a, 0x05, 0xac,
+  0xc0, 0xd0, 0x3b, 0x96, 0xf8, 0x02, 0xde, 0x94, 0x70, 0xf0, 0x7d, 0x8a, 0x3e, 0xba, 0x47, 0xb2,
+  0x68, 0x67, 0x76, 0x50, 0x91, 0x6a, 0x9a, 0xb8, 0x2f, 0xa6, 0x7e, 0x6d, 0xf5, 0xa5, 0xee, 0x78,
+  0xa7, 0x9f, 0x1a, 0xbe, 0xc4, 0x7d, 0xf8, 0x2e, 0x48, 0xc8, 0xf5, 0x84, 0x72, 0xc8, 0x74, 0xe9,
+  0xca, 0xc5, 0x2d, 0xfb, 0x50, 0x90, 0x07, 0x48, 0x10, 0x32, 0x03, 0x96, 0xd0, 0xaa, 0x10, 0xbf,
+  0xdb, 0xcd, 0x6e, 0x5d, 0xdf, 0xe3, 0x66, 0x37, 0xb3, 0x74, 0x70, 0xf0, 0x3c, 0xe0, 0x8b, 0x29,
+  0x3c, 0x7d, 0xb6, 0x3e, 0x11, 0xe0, 0xe8, 0x6b, 0x0c, 0x77, 0xaa, 0xf9, 0x45, 0x1e, 0x43, 0xa4,
+  0xfe, 0xfa, 0xf1, 0xdd, 0xa9, 0xca, 0x0a, 0x95, 0x63, 0x02, 0xe1, 0x4c, 0xca, 0x07, 0x7f, 0x17,
+  0x00, 0xa9, 0xc6, 0x4b, 0x3a, 0xd7, 0x69, 0x06, 0x0d, 0xd3, 0x67, 0x79, 0xed, 0xf2, 0x3a, 0x6a,
+  0x97, 0x2f, 0xbf, 0xda, 0x6a, 0xf7, 0xfd, 0xcb, 0x15, 0xe8, 0x07, 0xce, 0x98, 0x43, 0x00, 0x14,
+  0x4b, 0xb3, 0x10, 0x09, 0x9b, 0xde, 0x11, 0x99, 0x42, 0x81, 0x23, 0x52, 0x28, 0x2f, 0xf0, 0xe6,
+  0xab, 0xef, 0x98, 0xbb, 0xa9, 0x40, 0xaa, 0x21, 0xd9, 0xf2, 0xfc, 0x8e, 0x15, 0x0b, 0xb0, 0xad,
+  0x05, 0xcd, 0x04, 0x2e, 0x56, 0x76, 0x81, 0x73, 0x4a, 0x68, 0x7a, 0xd5, 0x8a, 0xd5, 0x12, 0x2b,
+  0x57, 0x83, 0x95, 0xb8, 0x60, 0x1c, 0xf4, 0x00, 0x3b, 0x41, 0x68, 0x7d, 0x8d, 0x7c, 0x28, 0x47,
+  0x27, 0x17, 0xed, 0x28, 0x15, 0x89, 0xa1, 0x06, 0x55, 0x7f, 0x27, 0x11, 0x04, 0x5b, 0xd4, 0xf6,
+  0x45, 0x12, 0x76, 0x4f, 0xb5, 0xc4, 0xdf, 0x12, 0xb9, 0xba, 0x3b, 0xe1, 0x18, 0x70, 0x4c, 0x6a,
+  0x65, 0x06, 0x1f, 0x53, 0xa5, 0xd2, 0x76, 0x34, 0x2b, 0x1c, 0xd4, 0x4c, 0x63, 0x40, 0x50, 0x33,
+  0x93, 0xc6, 0x78, 0x24, 0xb8, 0x86, 0x17, 0xd4, 0x00, 0xd6, 0xc0, 0x87, 0x09, 0x68, 0xdf, 0x77,
+  0xd9, 0x15, 0xad, 0x14, 0x16, 0x26, 0x2d, 0x04, 0xd7, 0xac, 0xd4, 0x23, 0x0d, 0x30, 0x12, 0xb7,
+  0x70, 0x36, 0x35, 0xe7, 0xbf, 0x49, 0xc8, 0xe8, 0x04, 0xd2, 0x03, 0x99, 0xd8, 0x2c, 0xdc, 0x6a,
+  0xa1, 0x2c, 0x3c, 0xbf, 0xe2, 0xf3, 0x16, 0x50, 0xb6, 0xc2, 0xa5, 0x1b, 0xe1, 0xce, 0x22, 0x23,
+  0x0a, 0xae, 0x21, 0xb8, 0xd2, 0xbb, 0x2e, 0xfb, 0x49, 0x8a, 0x34, 0x31, 0x6c, 0x2a, 0xc0, 0xbd,
+  0x25, 0x30, 0xd4, 0xc8, 0x16, 0xc0, 0xe0, 0x90, 0x62, 0xa9, 0x98, 0xc1, 0x21, 0x9b, 0x82, 0x17,
+  0xbb, 0xcf, 0xca, 0xd4, 0xa9, 0x82, 0x13, 0x19, 0x6f, 0x99, 0xa6, 0xc3, 0x8d, 0x97, 0xa6, 0xbf,
+  0xe3, 0x06, 0x37, 0xf1, 0x28, 0xf3, 0xa1, 0x10, 0x66, 0x1e, 0x6c, 0xd8, 0xee, 0xac, 0x0b, 0x28,
+  0x0c, 0x93, 0x03, 0x64, 0x9f, 0x8f, 0x03, 0x69, 0x77, 0xdc, 0xfb, 0x09, 0x2d, 0x80, 0x72, 0xb1,
+  0x04, 0x80, 0xf4, 0xbb, 0xf3, 0xf5, 0xca, 0x65, 0x95, 0x71, 0x69, 0x56, 0x1a, 0x13, 0xae, 0x83,
+  0x86, 0x4a, 0xcd, 0xd5, 0x0a, 0x1a, 0x71, 0xa3, 0xed, 0x86, 0xba, 0x18, 0x03, 0xad, 0x4d, 0x01,
+  0xba, 0xf9, 0x95, 0x32, 0xf8, 0xb1, 0x45, 0x26, 0x28, 0xa1, 0x2b, 0x51, 0xea, 0xdb, 0x22, 0x5b,
+  0x92, 0x4e, 0x29, 0xe7, 0xbf, 0x2b, 0xc9, 0xef, 0x2b, 0xa0, 0x1f, 0x9e, 0xe5, 0x4d, 0x6b, 0x75,
+  0x03, 0x1f, 0xfa, 0x03, 0x73, 0xf3, 0xd5, 0xec, 0xbf, 0x4b, 0x48, 0xb4, 0x4b, 0xa2, 0x38, 0xa5,
+  0xdf, 0xa4, 0x69, 0xb3, 0xf1, 0x29, 0x3c, 0x85, 0xae, 0x1f, 0xa6, 0xcb, 0xe9, 0xc3, 0xef, 0x66,
+  0xd3, 0x6d, 0x8f, 0x66, 0x56, 0xcd, 0xe7, 0x29, 0xee, 0x85, 0xe3, 0x02, 0x70, 0xcd, 0x5e, 0x20,
+  0x37, 0xdf, 0x7d, 0x20, 0xb6, 0xd8, 0x78, 0x3c, 0xae, 0xfc, 0x48, 0x7d, 0x4f, 0x7e, 0x71, 0x6b,
+  0x20, 0x3d, 0x6c, 0xf8, 0xd1, 0x45, 0x50, 0xb7, 0xcc, 0x69, 0xac, 0x39, 0x3e, 0x96, 0x6d, 0x77,
+  0x99, 0xfa, 0xd7, 0xb2, 0xdf, 0x9f, 0xfe, 0x99, 0x51, 0x0d, 0x02, 0x06, 0xec, 0x05, 0xf7, 0x13,
+  0x37, 0x17, 0xf2, 0x1f, 0x89, 0x91, 0xe1, 0x6f, 0x25, 0xbc, 0xe7, 0x07, 0x1d, 0x13, 0xd0, 0xb8,
+  0x6f, 0x6e, 0x88, 0x20, 0x43, 0x90, 0xc0, 0x5b, 0x28, 0x29, 0x85, 0x68, 0x6c, 0x0d, 0xf9, 0x54,
+  0xf1, 0xc4, 0x85, 0xfc, 0x16, 0x2a, 0xc7, 0xfe, 0x6f, 0x3c, 0x39, 0xaa, 0x14, 0xaa, 0x1d, 0x47,
+  0x98, 0xa0, 0xb7, 0x70, 0x20, 0xab, 0xdb, 0xee, 0x39, 0x3e, 0x3c, 0x5e, 0xaa, 0xa5, 0x8e, 0xd7,
+  0x93, 0x1d, 0x07, 0x30, 0x80, 0xf0, 0x28, 0x0c, 0xa4, 0xc0, 0x10, 0x37, 0xb4, 0xf6, 0x78, 0x69,
+  0xa0, 0x62, 0x02, 0x5e, 0x34, 0xc8, 0x76, 0xe3, 0x55, 0x75, 0x24, 0xa8, 0x3c, 0xaa, 0x12, 0xf9,
+  0xaf, 0x97, 0x1f, 0x2e, 0x60, 0x4b, 0xb5, 0x11, 0x4d, 0xd1, 0xc5, 0x3d, 0x6f, 0x51, 0xc5, 0xe4,
+  0x81, 0x80, 0xc1, 0x3e, 0x8a, 0xd9, 0x12, 0xdd, 0xd7, 0x04, 0x3a, 0xcf, 0x85, 0x73, 0x4a, 0xcc,
+  0x8b, 0x16, 0x83, 0x98, 0x9c, 0x03, 0x99, 0x51, 0x70, 0xce, 0x95, 0x02, 0xaa, 0xc7, 0x2f, 0x93,
+  0xf3, 0x02, 0xd0, 0x2d, 0x6c, 0x22, 0xdc, 0x0f, 0x79, 0xb2, 0x6e, 0x91, 0xd0, 0x5a, 0xe9, 0xd0,
+  0x1e, 0x34, 0x87, 0xf8, 0xc9, 0x49, 0x40, 0x40, 0x24, 0x77, 0x9e, 0x4a, 0x20, 0xe4, 0x82, 0x75,
+  0x76, 0x4f, 0xdf, 0x7f, 0xb8, 0x3c, 0x3f, 0x6b, 0x85, 0x5b, 0x52, 0x99, 0x7a, 0x0f, 0x04, 0x06,
+  0x9c, 0x5c, 0xf1, 0x51, 0x20, 0xb2, 0xf5, 0x91, 0xd6, 0xbd, 0xce, 0xc2, 0x05, 0x84, 0xfe, 0xa0,
+  0xfc, 0x3f, 0x44, 0xcc, 0xa9, 0x73, 0x68, 0x1e, 0x00, 0x00,
+};
+
+#endif // INDEX_HTML_GZ_H
@@ -0,0 +1,65 @@
+#ifndef LED_MAP_H
+#define LED_MAP_H
+
+#include "platform.h"
+
+// Grid -> strip index lookup table for the physical wiring of the panel.
+// The table is built once (at startup, or when the layout is changed) so XY() and the
+// row helpers below are a single load per pixel instead of bounds checks + modulo + branch.
+//
+// Build options: -DLED_LAYOUT=LAYOUT_SERPENTINE_COLUMNS -DLED_ORIENTATION=ORIENT_ROTATE_180
+// pick the wiring the firmware boots with; /set?layout=N&orient=M changes it at runtime.
+
+enum LedLayout : uint8_t {
+  LAYOUT_ZIGZAG_ROWS = 0,          // rows, odd rows run right to left (the 9x144 panel)
+  LAYOUT_PROGRESSIVE_ROWS = 1,     // rows, every row runs left to right
+  LAYOUT_SERPENTINE_COLUMNS = 2,   // columns, odd columns run bottom to top
+  LAYOUT_PROGRESSIVE_COLUMNS = 3,  // columns, every column runs top to bottom
+  LAYOUT_COUNT
+};
+
+// Applied on top of the layout: panel mounted mirrored or upside down.
+enum LedOrientation : uint8_t {
+  ORIENT_NORMAL = 0,
+  ORIENT_MIRROR_X = 1,
+  ORIENT_MIRROR_Y = 2,
+  ORIENT_ROTATE_180 = 3,           // MIRROR_X | MIRROR_Y
+};
+
+#ifndef LED_LAYOUT
+#define LED_LAYOUT LAYOUT_ZIGZAG_ROWS
+#endif
+
+#ifndef LED_ORIENTATION
+#define LED_ORIENTATION ORIENT_NORMAL
+#endif
+
+#define GRID_LEDS (GRID_WIDTH * GRID_HEIGHT)
+
+// ledMap[y * GRID_WIDTH + x] = strip index of grid cell (x, y)
+extern uint16_t ledMap[GRID_LEDS];
+
+// Rebuilds the table. Out-of-range values fall back to zigzag rows / normal.
+void ledMapInit(uint8_t layout, uint8_t orientation);
+uint8_t ledMapLayout();
+uint8_t ledMapOrientation();
+
+// Strip indices of grid row y, indexed by x: leds[xyRow(y)[x]]. Works for every layout.
+inline const uint16_t* xyRow(int y) {
+  return &ledMap[y * GRID_WIDTH];
+}
+
+// True when every grid row is one contiguous run on the strip (row layouts), so a row
+// can be addressed as xyRowStart(y) + x * xyRowStep(y).
+bool ledMapRowsContiguous();
+
+inline int xyRowStart(int y) {
+  return ledMap[y * GRID_WIDTH];
+}
+
+// +1 or -1 for row layouts (direction of row y on the strip)
+inline int xyRowStep(int y) {
+  return (int)ledMap[y * GRID_WIDTH + 1] - (int)ledMap[y * GRID_WIDTH];
+}
+
+#endif // LED_MAP_H
@@ -0,0 +1,154 @@
+#ifndef LIFE_BOARD_H
+#define LIFE_BOARD_H
+
+#include "platform.h"
+
+// Bit-packed Conway's Game of Life on a W x H torus (pattern 111).
+//
+// Each row is kWords 64-bit words, bit x of the row = cell x. A generation is computed a
+// whole row at a time with bitwise adders over the eight shifted neighbour rows, instead
+// of eight wrapped lookups per cell. The next generation is built in a second board by
+// advance(), which can be called for a few rows per frame so the work is spread out, and
+// shown with commit().
+//
+// commit() also keeps hashes of the last kHistory generations. staleGenerations() counts
+// how long the board has been repeating one of them (still lifes, blinkers, short
+// oscillators, an empty board), so the caller can reseed instead of showing a dead panel.
+template <int W, int H>
+class LifeBoard {
+ public:
+  static const int kWords = (W + 63) / 64;
+  static const int kHistory = 16;  // catches oscillators with period <= 16
+
+  LifeBoard() { clear(); }
+
+  // Random board, each cell alive with probability densityPct / 100.
+  void seed(uint8_t densityPct) {
+    clear();
+    for (int y = 0; y < H; y++) {
+      for (int x = 0; x < W; x++) {
+        if (random8(100) < densityPct) cur_[y][x >> 6] |= 1ULL << (x & 63);
+      }
+    }
+  }
+
+  bool alive(int x, int y) const { return (cur_[y][x >> 6] >> (x & 63)) & 1; }
+
+  const uint64_t* row(int y) const { return cur_[y]; }
+
+  // Computes up to `rows` more rows of the next generation. Returns true once all H rows
+  // are done (further calls do nothing until commit()).
+  bool advance(int rows) {
+    for (; rows > 0 && nextRow_ < H; rows--, nextRow_++) {
+      stepRow(nextRow_);
+    }
+    return nextRow_ == H;
+  }
+
+  // Makes the finished next generation current. Returns false (and does nothing) if
+  // advance() has not completed it yet.
+  bool commit() {
+    if (nextRow_ < H) return false;
+    memcpy(cur_, next_, sizeof(cur_));
+    nextRow_ = 0;
+    generation_++;
+
+    uint32_t h = hash();
+    bool seen = false;
+    for (int i = 0; i < kHistory; i++) {
+      if (history_[i] == h) seen = true;
+    }
+    history_[historyPos_] = h;
+    historyPos_ = (historyPos_ + 1) % kHistory;
+    stale_ = seen ? stale_ + 1 : 0;
+    return true;
+  }
+
+  // Consecutive generations that repeated one of the previous kHistory generations
+  uint32_t staleGenerations() const { return stale_; }
+
+  uint32_t generation() const { return generation_; }
+
+ private:
+  // Valid bits of the last word of a row
+  static uint64_t lastMask() { return (W % 64) ? ((1ULL << (W % 64)) - 1) : ~0ULL; }
+
+  void clear() {
+    memset(cur_, 0, sizeof(cur_));
+    nextRow_ = 0;
+    generation_ = 0;
+    stale_ = 0;
+    historyPos_ = 0;
+    for (int i = 0; i < kHistory; i++) history_[i] = 0xFFFFFFFFu;  // never a real hash
+  }
+
+  // out(x) = in(x - 1), wrapping at the row ends
+  static void shiftWest(const uint64_t* in, uint64_t* out) {
+    for (int i = kWords - 1; i > 0; i--) out[i] = (in[i] << 1) | (in[i - 1] >> 63);
+    out[0] = (in[0] << 1) | ((in[(W - 1) >> 6] >> ((W - 1) & 63)) & 1);
+    out[kWords - 1] &= lastMask();
+  }
+
+  // out(x) = in(x + 1), wrapping at the row ends
+  static void shiftEast(const uint64_t* in, uint64_t* out) {
+    for (int i = 0; i < kWords - 1; i++) out[i] = (in[i] >> 1) | (in[i + 1] << 63);
+    out[kWords - 1] = in[kWords - 1] >> 1;
+    out[(W - 1) >> 6] |= (in[0] & 1) << ((W - 1) & 63);
+  }
+
+  void stepRow(int y) {
+    const uint64_t* up = cur_[(y + H - 1) % H];
+    const uint64_t* mid = cur_[y];
+    const uint64_t* down = cur_[(y + 1) % H];
+    uint64_t upW[kWords], upE[kWords], midW[kWords], midE[kWords], downW[kWords], downE[kWords];
+    shiftWest(up, upW);
+    shiftEast(up, upE);
+    shiftWest(mid, midW);
+    shiftEast(mid, midE);
+    shiftWest(down, downW);
+    shiftEast(down, downE);
+
+    for (int i = 0; i < kWords; i++) {
+      // Per-row neighbour counts as 2-bit numbers: u = 0..3, m = 0..2 (no centre), d = 0..3
+      uint64_t u0 = upW[i] ^ up[i] ^ upE[i];
+      uint64_t u1 = (upW[i] & up[i]) | (upE[i] & (upW[i] ^ up[i]));
+      uint64_t m0 = midW[i] ^ midE[i];
+      uint64_t m1 = midW[i] & midE[i];
+      uint64_t d0 = downW[i] ^ down[i] ^ downE[i];
+      uint64_t d1 = (downW[i] & down[i]) | (downE[i] & (downW[i] ^ down[i]));
+
+      // total = s0 + 2 * (number of set bits among u1, m1, d1, c0)
+      uint64_t s0 = u0 ^ m0 ^ d0;
+      uint64_t c0 = (u0 & m0) | (d0 & (u0 ^ m0));
+      uint64_t p = u1 ^ m1;
+      uint64_t q = d1 ^ c0;
+      uint64_t twos = (p ^ q) & ~((u1 & m1) | (d1 & c0));  // exactly one: total is 2 or 3
+
+      // Born with 3, survives with 2 or 3
+      next_[y][i] = twos & (s0 | mid[i]);
+    }
+    next_[y][kWords - 1] &= lastMask();
+  }
+
+  // FNV-1a over the board, 32 bits at a time
+  uint32_t hash() const {
+    uint32_t h = 2166136261u;
+    for (int y = 0; y < H; y++) {
+      for (int i = 0; i < kWords; i++) {
+        h = (h ^ (uint32_t)cur_[y][i]) * 16777619u;
+        h = (h ^ (uint32_t)(cur_[y][i] >> 32)) * 16777619u;
+      }
+    }
+    return h;
+  }
+
+  uint64_t cur_[H][kWords];
+  uint64_t next_[H][kWords];
+  int nextRow_;
+  uint32_t generation_;
+  uint32_t stale_;
+  uint32_t history_[kHistory];
+  int historyPos_;
+};
+
+#endif // LIFE_BOARD_H
@@ -0,0 +1,48 @@
+#ifndef NOISE_FIELD_H
+#define NOISE_FIELD_H
+
+#include "platform.h"
+
+// Fixed-point gradient noise, bit-exact with FastLED's inoise8 (3D) on the device.
+//
+// NoiseField8 evaluates a whole GRID_WIDTH x GRID_HEIGHT slice per call:
+//   out[y * GRID_WIDTH + x] == inoise8(x0 + x * dx, y0 + y * dy, z)
+// The per-column and per-row lattice terms are computed once, and the corner hashes of
+// each lattice cell are kept until z crosses into the next cell, so animating z (the
+// usual case) only pays for the per-pixel gradient blend.
+
+class NoiseField8 {
+ public:
+  NoiseField8(uint16_t x0, uint16_t dx, uint16_t y0, uint16_t dy);
+
+  // Fills out[GRID_WIDTH * GRID_HEIGHT] with the noise slice at z.
+  void fill(uint8_t* out, uint16_t z);
+
+ private:
+  static const int kMaxRuns = 16;  // lattice cells per row we keep hashes for
+
+  void buildAxes();
+
+  uint16_t x0_, dx_, y0_, dy_;
+  bool axesReady_;
+  int runCount_;
+  int cachedZ_;                    // lattice z the hash cache belongs to, -1 = empty
+
+  uint8_t colEase_[GRID_WIDTH];    // eased fraction along x
+  int8_t colFrac_[GRID_WIDTH];     // signed fraction for the gradients
+  uint8_t colRun_[GRID_WIDTH];     // which lattice cell (run) the column falls in
+  uint8_t runCell_[kMaxRuns];      // lattice x of each run
+  uint8_t rowCell_[GRID_HEIGHT];
+  uint8_t rowEase_[GRID_HEIGHT];
+  int8_t rowFrac_[GRID_HEIGHT];
+  uint8_t hashes_[GRID_HEIGHT][kMaxRuns][8];
+};
+
+#ifdef SIMULATOR
+// Scalar versions (FastLED provides these on the device)
+uint8_t inoise8(uint16_t x, uint16_t y, uint16_t z);
+uint8_t inoise8(uint16_t x, uint16_t y);
+uint16_t inoise16(uint32_t x, uint32_t y, uint32_t z);
+#endif
+
+#endif // NOISE_FIELD_H
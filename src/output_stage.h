@@ -0,0 +1,153 @@
+#ifndef OUTPUT_STAGE_H
+#define OUTPUT_STAGE_H
+
+#include <math.h>
+#include "platform.h"
+
+// Last step between the pattern buffer and the strip: brightness, gamma and white balance
+// (LED color correction) fused into one 256-entry table per channel, applied in a single
+// pass. The firmware sends the result with FastLED's own brightness at 255, correction
+// off and dithering off, and the simulator shows the same bytes (sim_get_buffer), so a
+// preview matches the panel.
+//
+//   outputStage.apply(leds, frame, count);   // leds stays untouched for the next frame
+//
+// The tables are rebuilt on the first apply() after a setting changed. Per channel the
+// scale is FastLED's own (CLEDController::computeAdjustment), so gamma 1.0 gives the bytes
+// setBrightness() + setCorrection() used to put on the wire, minus temporal dithering.
+//
+// The same pass sums the output channels for a power estimate (FastLED's power_mgt model)
+// of every frame. Over the power budget, the frame is scaled down to fit; under it, it is
+// left alone, so dim frames keep full brightness. The last kPowerHistory estimates are
+// kept for /power and sim_get_power_history().
+class OutputStage {
+ public:
+  static const uint32_t kUncorrected = 0xFFFFFF;
+  static const uint32_t kTypicalLEDStrip = 0xFFB0F0;  // FastLED TypicalLEDStrip
+  static const int kPowerHistory = 64;
+
+  // mW per LED at full channel value, and for a dark LED, at 5 V (FastLED power_mgt.cpp)
+  static const uint32_t kRedMw = 16 * 5;
+  static const uint32_t kGreenMw = 11 * 5;
+  static const uint32_t kBlueMw = 15 * 5;
+  static const uint32_t kDarkMw = 1 * 5;
+
+  struct PowerSample {
+    uint32_t requestedMw;  // estimate for the frame as rendered
+    uint32_t drawMw;       // after the limiter (an upper bound: nscale8 rounds down)
+    uint8_t limit;         // scale the limiter applied, 255 = not limited
+  };
+
+  OutputStage()
+      : brightness_(255), gamma10_(10), correction_(kUncorrected), dirty_(true), budgetMw_(0),
+        historyPos_(0), historyCount_(0), limitChanged_(false) {
+    history_[0] = {0, 0, 255};
+  }
+
+  // brightness 0-255, gamma in tenths (10 = linear, 22 = typical), correction 0xRRGGBB.
+  // Returns true if anything changed (the strip then needs a full resend).
+  bool configure(uint8_t brightness, uint8_t gamma10, uint32_t correction) {
+    if (gamma10 < 10) gamma10 = 10;
+    if (gamma10 > 30) gamma10 = 30;
+    correction &= 0xFFFFFF;
+    if (brightness == brightness_ && gamma10 == gamma10_ && correction == correction_) return false;
+    brightness_ = brightness;
+    gamma10_ = gamma10;
+    correction_ = correction;
+    dirty_ = true;
+    return true;
+  }
+
+  uint8_t brightness() const { return brightness_; }
+  uint8_t gamma10() const { return gamma10_; }
+  uint32_t correction() const { return correction_; }
+
+  // Most the whole chain may draw, in mW; 0 = no limit
+  void setPowerBudget(uint32_t mw) { budgetMw_ = mw; }
+  uint32_t powerBudget() const { return budgetMw_; }
+
+  // dst[i] = tables applied to src[i], for i in [0, count), where count is the whole chain
+  // (the power estimate is for these LEDs). src and dst may be the same.
+  void apply(const CRGB* src, CRGB* dst, int count) {
+    if (dirty_) rebuild();
+    const uint8_t* r = lut_[0];
+    const uint8_t* g = lut_[1];
+    const uint8_t* b = lut_[2];
+    uint32_t sumR = 0, sumG = 0, sumB = 0;
+    for (int i = 0; i < count; i++) {
+      uint8_t rv = r[src[i].r], gv = g[src[i].g], bv = b[src[i].b];
+      dst[i].r = rv;
+      dst[i].g = gv;
+      dst[i].b = bv;
+      sumR += rv;
+      sumG += gv;
+      sumB += bv;
+    }
+
+    const uint32_t darkMw = count * kDarkMw;  // drawn whatever the colors
+    const uint32_t colorMw = (sumR * kRedMw + sumG * kGreenMw + sumB * kBlueMw) >> 8;
+    PowerSample sample;
+    sample.requestedMw = darkMw + colorMw;
+    sample.drawMw = sample.requestedMw;
+    sample.limit = 255;
+    if (budgetMw_ > 0 && sample.requestedMw > budgetMw_ && colorMw > 0) {
+      // Like calculate_max_brightness_for_power_mW, but only the color part scales, and
+      // nscale8 multiplies by (limit + 1) / 256, so pick the largest limit within budget
+      uint32_t room = budgetMw_ > darkMw ? budgetMw_ - darkMw : 0;
+      uint64_t fit = 256u * (uint64_t)room / colorMw;  // < 256, as colorMw > room
+      sample.limit = (uint8_t)(fit > 0 ? fit - 1 : 0);
+      nscale8(dst, count, sample.limit);
+      sample.drawMw = darkMw + (uint32_t)((uint64_t)colorMw * (sample.limit + 1) >> 8);
+    }
+    limitChanged_ = sample.limit != lastPower().limit;
+    historyPos_ = (historyPos_ + 1) % kPowerHistory;
+    history_[historyPos_] = sample;
+    if (historyCount_ < kPowerHistory) historyCount_++;
+  }
+
+  // True if the last apply() limited the frame by a different amount than the one before:
+  // LEDs that are not resent would keep the old scale, so send the whole chain.
+  bool limitChanged() const { return limitChanged_; }
+
+  const PowerSample& lastPower() const { return history_[historyPos_]; }
+
+  // Copies up to `max` recent samples, oldest first; returns how many
+  int powerHistory(PowerSample* out, int max) const {
+    int n = historyCount_ < max ? historyCount_ : max;
+    for (int i = 0; i < n; i++) {
+      out[i] = history_[(historyPos_ + kPowerHistory - n + 1 + i) % kPowerHistory];
+    }
+    return n;
+  }
+
+ private:
+  void rebuild() {
+    uint8_t curve[256];
+    for (int v = 0; v < 256; v++) {
+      curve[v] = (gamma10_ == 10) ? v : (uint8_t)(powf(v / 255.0f, gamma10_ / 10.0f) * 255.0f + 0.5f);
+    }
+    for (int c = 0; c < 3; c++) {
+      // computeAdjustment with color temperature off: (cc + 1) * 256 * brightness / 65536
+      uint8_t cc = (correction_ >> (16 - 8 * c)) & 0xFF;
+      uint8_t scale = (cc > 0) ? (uint8_t)(((uint32_t)cc + 1) * brightness_ >> 8) : 0;
+      for (int v = 0; v < 256; v++) {
+        lut_[c][v] = scale8(curve[v], scale);
+      }
+    }
+    dirty_ = false;
+  }
+
+  uint8_t lut_[3][256];
+  uint8_t brightness_;
+  uint8_t gamma10_;
+  uint32_t correction_;
+  bool dirty_;
+
+  uint32_t budgetMw_;
+  PowerSample history_[kPowerHistory];  // ring, newest at historyPos_
+  int historyPos_;
+  int historyCount_;
+  bool limitChanged_;
+};
+
+#endif // OUTPUT_STAGE_H
@@ -0,0 +1,65 @@
+#ifndef PALETTE_H
+#define PALETTE_H
+
+#include "platform.h"
+
+// Color schemes for the patterns, as 256-entry RGB lookup tables.
+//
+// A scheme is 16 colors in flash, evenly spaced over the index range like FastLED's
+// CRGBPalette16; select() expands it once into a full table with linear blending between
+// neighbours (wrapping from the last back to the first). Patterns then color a pixel with
+// one lookup, lut[index], instead of an HSV conversion per pixel. Scheme 0 is the HSV
+// rainbow itself: lut[h] == CHSV(h, 255, 255), and paletteColor(lut, h, v) ==
+// CHSV(h, 255, v), so patterns that used the color wheel look the same with it.
+//
+// Switching schemes does not jump: the table patterns read moves towards the new one by
+// up to 255 / kBlendMs per ms and channel (nblendPaletteTowardPalette style), so the
+// change is spread over several frames.
+//
+//   palettes.select(id);                 // from /set?palette=N
+//   palettes.update(millis());           // once per frame, before rendering
+//   params.palette = palettes.lut();
+class PaletteEngine {
+ public:
+  static const uint32_t kBlendMs = 600;  // a full 0 -> 255 channel swing
+
+  PaletteEngine();
+
+  // Expands scheme `id` as the target; the table blends over to it unless `blend` is false.
+  // False if there is no such scheme.
+  bool select(int id, bool blend = true);
+
+  // Moves the table towards the target for the time since the last call
+  void update(unsigned long nowMs);
+
+  const CRGB* lut() const { return current_; }
+  int selected() const { return id_; }
+  bool blending() const { return blending_; }
+
+  static int count();
+  static const char* name(int id);  // PROGMEM string, nullptr for an unknown id
+
+ private:
+  static void expand(int id, CRGB* out);
+
+  CRGB current_[256];  // what patterns read
+  CRGB target_[256];   // the selected scheme
+  int id_;
+  bool blending_;
+  unsigned long lastMs_;
+};
+
+// lut[index] at CHSV value `val`: the same dimming curve CHSV applies after the hue, so
+// with scheme 0 this is exactly CHSV(index, 255, val).
+inline CRGB paletteColor(const CRGB* lut, uint8_t index, uint8_t val) {
+  CRGB c = lut[index];
+  if (val != 255) {
+    uint8_t v = scale8_video(val, val);
+    c.r = scale8(c.r, v);
+    c.g = scale8(c.g, v);
+    c.b = scale8(c.b, v);
+  }
+  return c;
+}
+
+#endif // PALETTE_H
@@ -0,0 +1,102 @@
+#ifndef PATTERN_REGISTRY_H
+#define PATTERN_REGISTRY_H
+
+#include "patterns.h"
+
+// Pattern registry shared by the firmware (main.cpp) and the simulator (sim_core.cpp).
+// The table itself lives in patterns/pattern_registry.cpp: one line per pattern with its
+// id, UI name, button style, flags and target frame rate. Dispatch is an id-indexed lookup, so adding a
+// pattern means adding a table line - no switch, no hand-kept button list.
+//
+// Patterns that keep data between frames declare a state struct in patterns.h. It is
+// allocated when the pattern is activated and freed when another one takes over (see
+// PatternInstance), so only the running pattern's buffers are resident.
+//
+// Build option: -DPATTERN_SUBSET=0,1,2,3,4,100,109 compiles in only those ids. The other
+// pattern functions are never referenced and get dropped by the linker (flash + IRAM).
+
+// Extra inputs for patterns that need more than the frame buffer.
+struct PatternParams {
+  const char* text;        // scrolling text (120)
+  int* scrollOffset;       // scroll position, owned by the caller (120)
+  int scrollSpeed;         // ms per scroll step (120)
+  const CRGB* custom;      // designer frame (122), nullptr when nothing is uploaded
+  int customScrollMs;      // ms per column the designer frame scrolls left, 0 = static (122)
+  FlipbookPlayer* flipbook;  // stored animation (123), nullptr when there is none
+  const CRGB* palette;     // 256-entry color table (see palette.h), owned by the caller
+};
+
+typedef void (*PatternFn)(CRGB* leds, int activeLeds, const FrameContext& ctx, void* state);
+typedef void* (*PatternCreateFn)();        // returns a fresh state, nullptr if out of memory
+typedef void (*PatternDestroyFn)(void* state);
+
+enum PatternFlags : uint8_t {
+  PATTERN_2D     = 0x01,   // draws through XY() on the GRID_WIDTH x GRID_HEIGHT grid
+  PATTERN_TRAIL  = 0x02,   // reads back the previous frame (fades/trails): buffer is not cleared first
+  PATTERN_BASIC  = 0x04,   // listed under "Basic" in the web UI
+  PATTERN_HIDDEN = 0x08,   // no generic UI button (has its own controls: text tab, designer)
+};
+
+// Descriptors are stored in PROGMEM; name/style point at PROGMEM strings.
+struct PatternDesc {
+  PatternFn fn;
+  PatternCreateFn create;  // nullptr for stateless patterns
+  PatternDestroyFn destroy;
+  const char* name;
+  const char* style;       // CSS class of the web UI button
+  uint8_t id;
+  uint8_t flags;
+  uint8_t fps;             // target frame rate, 0 = FrameScheduler::kDefaultFps
+};
+
+// Number of compiled-in patterns, in table order.
+int patternCount();
+
+// Copies the descriptor at table position `index` into `out`.
+bool patternAt(int index, PatternDesc& out);
+
+// O(1) lookup by pattern id. Returns false if the id is unknown or not compiled in.
+bool findPattern(int id, PatternDesc& out);
+
+// One running pattern and its state. Instances are independent, so several can render
+// side by side (e.g. one per simulated panel). Each also has its own random8/random16
+// stream: render() swaps it into FastLED's global LCG seed and back, so a pattern's
+// random numbers do not depend on what else ran in between. Each keeps its own frame
+// clock too (the FrameContext's dt, frame and steps).
+class PatternInstance {
+ public:
+  PatternInstance() : state_(nullptr), id_(-1), ready_(false), rng_(0), frames_(0), lastMs_(0), carryMs_(0) {}
+  ~PatternInstance() { deactivate(); }
+
+  // Switches to pattern `id`, freeing the previous state and allocating a fresh one, and
+  // starts a new random stream drawn from the global one. No-op if `id` is already active. Returns false if the id is unknown or the state
+  // could not be allocated; render() then draws black.
+  bool activate(int id);
+
+  // Frees the state; the next activate() starts the pattern from scratch.
+  void deactivate();
+
+  // Clears the buffer unless the pattern keeps trails, then renders one frame at millis().
+  void render(CRGB* leds, int activeLeds, uint8_t& hue, const PatternParams& params);
+
+  // Restarts this instance's random stream (reproducible renders)
+  void seed(uint16_t seed) { rng_ = seed; }
+
+  // Active pattern id, -1 if none
+  int id() const { return id_; }
+
+ private:
+  PatternInstance(const PatternInstance&) = delete;
+  PatternInstance& operator=(const PatternInstance&) = delete;
+
+  PatternDesc desc_;
+  void* state_;
+  int id_;
+  bool ready_;
+  uint16_t rng_;   // random16 seed of this instance's stream
+  uint32_t frames_;        // frames rendered since activate()
+  unsigned long lastMs_;   // time of the previous frame
+  int32_t carryMs_;        // ms not yet turned into steps (negative: a step taken early)
+};
+
+#endif // PATTERN_REGISTRY_H
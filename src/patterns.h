@@ -2,18 +2,104 @@
 #define PATTERNS_H
 
 #include "platform.h"
+#include "led_map.h"
+#include "noise_field.h"
+#include "life_board.h"
+#include "palette.h"
 
-// XY mapping function (zigzag wiring)
+// XY mapping function: grid (x, y) -> strip index through the wiring table in led_map.h.
+// Returns -1 outside the grid. Inner loops over whole rows should use xyRow(y) instead.
 inline int XY(int x, int y) {
   if (x < 0 || x >= GRID_WIDTH || y < 0 || y >= GRID_HEIGHT) return -1;
+  return ledMap[y * GRID_WIDTH + x];
+}
+
+struct PatternParams;
+
+// What a pattern gets for each frame, filled in by PatternInstance::render().
+//
+// Motion follows the clock, not the number of frames rendered. A pattern advances by
+// `steps`: the number of kFrameTickMs ticks (the 50 fps the patterns were written for)
+// since its previous frame, rounded to the nearest tick with the remainder carried over.
+// At 50 fps steps is 1, so `hue += ctx.steps` is the old `hue++`; when show() holds a big
+// panel to 25 fps it is 2 and the animation keeps its speed; faster than 50 fps some
+// frames get 0. Per-tick simulations (fire, falling drops, particles) run once per step.
+// Gaps longer than kMaxFrameSteps ticks (a flash write, a slow upload) are not caught up.
+//
+// Timing reads `now` rather than millis(): one clock read per frame, and in the simulator
+// the simulated clock, so a run at any step size is reproducible. random8()/random16()
+// draw from the instance's own stream while the pattern renders (see PatternInstance).
+//
+// Colors come from `palette`, the selected scheme as 256 entries: palette[h] where the
+// pattern used CHSV(h, 255, 255), paletteColor(palette, h, v) for CHSV(h, 255, v).
+struct FrameContext {
+  static const uint32_t kFrameTickMs = 20;
+  static const uint8_t kMaxFrameSteps = 5;
+
+  uint32_t now;      // ms, the frame's time
+  uint32_t dt;       // ms since this pattern's previous frame, 0 on its first
+  uint32_t frame;    // frames rendered since the pattern was activated
+  uint8_t steps;     // ticks to advance this frame, 1 on the first
+  uint8_t& hue;      // shared color wheel position
+  const CRGB* palette;  // color scheme, 256 entries (params.palette)
+  const PatternParams& params;
+};
+
+// Per-instance replacement for EVERY_N_MILLISECONDS. Kept in a pattern's state, so it
+// restarts with the pattern instead of being shared by every call site.
+//
+// every() returns how many periods have passed since the last one (0 if none) and keeps
+// the remainder, so a 50 ms timer fires 20 times a second at 50 fps, 25 fps or 10 fps.
+// Move by the count (`pos += s.timer.every(ctx.now, 50)`), not once per call. The first
+// call starts the clock (0 periods), like the pattern's first frame starts its steps. As
+// with FrameContext::steps, a gap of more than kMaxCatchUpMs (or one period, if longer)
+// is not caught up: it counts once and the timer restarts from `now`.
+struct PatternTimer {
+  static const unsigned long kMaxCatchUpMs = 250;
+
+  unsigned long last = 0;
+  bool started = false;
 
-  if (y % 2 == 0) {
-    // Even rows (0, 2, 4, 6, 8): left to right
-    return y * GRID_WIDTH + x;
-  } else {
-    // Odd rows (1, 3, 5, 7): right to left (reversed)
-    return y * GRID_WIDTH + (GRID_WIDTH - 1 - x);
+  uint16_t every(unsigned long now, unsigned long ms) {
+    if (!started) {
+      started = true;
+      last = now;
+      return 0;
+    }
+    unsigned long elapsed = now - last;
+    if (ms == 0 || elapsed < ms) return 0;
+    if (elapsed > (ms > kMaxCatchUpMs ? ms : kMaxCatchUpMs)) {
+      last = now;
+      return 1;
+    }
+    unsigned long n = elapsed / ms;
+    last += n * ms;
+    return (uint16_t)n;
   }
+};
+
+// fadeToBlackBy() for `steps` ticks at once, so trails fade at the same rate per second
+// whatever the frame rate. One step is exactly fadeToBlackBy(amount); zero leaves leds[].
+inline void fadeToBlackBySteps(CRGB* leds, int n, uint8_t amount, uint8_t steps) {
+  if (steps == 0) return;
+  uint16_t keep = 255 - amount;
+  uint16_t left = keep;
+  for (uint8_t i = 1; i < steps; i++) left = left * keep / 255;
+  fadeToBlackBy(leds, n, (uint8_t)(255 - left));
+}
+
+// n consecutive random8(min, lim) values (0..lim-1 when min is 0): the same numbers,
+// from the same stream, as n separate calls, but the LCG state stays in a register.
+// Use it to draw a whole row of random bytes at once.
+inline void fill_random8(uint8_t* out, int n, uint8_t min, uint8_t lim) {
+  uint16_t seed = random16_get_seed();
+  const uint8_t delta = lim - min;
+  for (int i = 0; i < n; i++) {
+    seed = (uint16_t)(seed * 2053 + 13849);  // FastLED's random16 step
+    uint8_t r = (uint8_t)((uint8_t)(seed & 0xFF) + (uint8_t)(seed >> 8));
+    out[i] = (uint8_t)((r * delta) >> 8) + min;
+  }
+  random16_set_seed(seed);
 }
 
 // Font data for scrolling text
@@ -25,30 +111,310 @@ extern const uint8_t font5x7[][5];
 int getFontIndex(char c);
 
 // Pattern function declarations
-// Each pattern is a standalone function that can be called from main.cpp or simulator
-
-void pattern_horizontal_bars(CRGB* leds, int activeLeds, uint8_t& hue);
-void pattern_vertical_ripple(CRGB* leds, int activeLeds, uint8_t& hue);
-void pattern_fire_rising(CRGB* leds, int activeLeds, uint8_t& hue);
-void pattern_rain_drops(CRGB* leds, int activeLeds, uint8_t& hue);
-void pattern_vertical_equalizer(CRGB* leds, int activeLeds, uint8_t& hue);
-void pattern_scanning_lines(CRGB* leds, int activeLeds, uint8_t& hue);
-void pattern_checkerboard(CRGB* leds, int activeLeds, uint8_t& hue);
-void pattern_diagonal_sweep(CRGB* leds, int activeLeds, uint8_t& hue);
-void pattern_vertical_wave(CRGB* leds, int activeLeds, uint8_t& hue);
-void pattern_plasma_2d(CRGB* leds, int activeLeds, uint8_t& hue);
-void pattern_matrix_rain(CRGB* leds, int activeLeds, uint8_t& hue);
-void pattern_game_of_life(CRGB* leds, int activeLeds, uint8_t& hue);
-void pattern_wave_pool(CRGB* leds, int activeLeds, uint8_t& hue);
-void pattern_aurora_2d(CRGB* leds, int activeLeds, uint8_t& hue);
-void pattern_lava_lamp(CRGB* leds, int activeLeds, uint8_t& hue);
-void pattern_ripple_2d(CRGB* leds, int activeLeds, uint8_t& hue);
-void pattern_starfield(CRGB* leds, int activeLeds, uint8_t& hue);
-void pattern_side_fire(CRGB* leds, int activeLeds, uint8_t& hue);
-void pattern_scrolling_rainbow(CRGB* leds, int activeLeds, uint8_t& hue);
-void pattern_particle_fountain(CRGB* leds, int activeLeds, uint8_t& hue);
-void pattern_scrolling_text(CRGB* leds, int activeLeds, uint8_t& hue,
-                           const char* text, int& scrollOffset, int scrollSpeed);
-void pattern_test_card(CRGB* leds, int activeLeds, uint8_t& hue);
+// Each pattern is a standalone function that can be called from main.cpp or simulator.
+// Patterns that carry data between frames take a state struct, declared next to them.
+// The registry value-initialises it (members not given a default are zeroed) when the
+// pattern is activated and frees it when another pattern takes over.
+
+struct FireRisingState {
+  uint8_t heat[GRID_HEIGHT][GRID_WIDTH];
+};
+
+struct ScanningLinesState {
+  int scanLine = 0;
+  PatternTimer step;
+};
+
+struct MatrixRainState {
+  uint8_t drops[GRID_WIDTH];
+  bool started = false;
+};
+
+struct GameOfLifeState {
+  LifeBoard<GRID_WIDTH, GRID_HEIGHT> life;
+  unsigned long lastUpdate = 0;
+  bool started = false;
+};
+
+struct LavaLampState {
+  // Correct for aspect ratio in noise calculation: y steps are much larger than x steps
+  NoiseField8 blob1{0, 10, 0, 70};
+  NoiseField8 blob2{0, 15, 0, 100};
+  uint8_t field1[GRID_LEDS];
+  uint8_t field2[GRID_LEDS];
+};
+
+struct Ripple2DState {
+  int centerX = GRID_WIDTH / 2;
+  int centerY = GRID_HEIGHT / 2;
+  PatternTimer move;
+};
+
+struct StarfieldState {
+  static const int kStars = 20;
+  float stars[kStars][3];  // x, y, speed
+  bool started = false;
+};
+
+struct SideFireState {
+  uint8_t heatLeft[GRID_HEIGHT][GRID_WIDTH / 2];
+  uint8_t heatRight[GRID_HEIGHT][GRID_WIDTH / 2];
+};
+
+struct ScrollingRainbowState {
+  int scrollPos = 0;
+  PatternTimer step;
+};
+
+struct ParticleFountainState {
+  static const int kParticles = 30;
+  float particles[kParticles][4];  // x, y, vx, vy
+  bool started = false;
+};
+
+struct ScrollingTextState {
+  PatternTimer scroll;
+};
+
+struct TestCardState {
+  int pos = 0;
+};
+
+struct CustomFrameState {
+  int offset = 0;  // columns scrolled
+  PatternTimer scroll;
+};
+
+struct FlipbookState {
+  bool started = false;
+  int activeLeds = 0;            // leds[] holds the last frame for this many LEDs
+  unsigned long frameStart = 0;  // when the shown frame's duration began
+};
+
+class FlipbookPlayer;
+
+void pattern_horizontal_bars(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_vertical_ripple(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_fire_rising(CRGB* leds, int activeLeds, const FrameContext& ctx, FireRisingState& s);
+void pattern_rain_drops(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_vertical_equalizer(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_scanning_lines(CRGB* leds, int activeLeds, const FrameContext& ctx, ScanningLinesState& s);
+void pattern_checkerboard(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_diagonal_sweep(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_vertical_wave(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_plasma_2d(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_matrix_rain(CRGB* leds, int activeLeds, const FrameContext& ctx, MatrixRainState& s);
+void pattern_game_of_life(CRGB* leds, int activeLeds, const FrameContext& ctx, GameOfLifeState& s);
+void pattern_wave_pool(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_aurora_2d(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_lava_lamp(CRGB* leds, int activeLeds, const FrameContext& ctx, LavaLampState& s);
+void pattern_ripple_2d(CRGB* leds, int activeLeds, const FrameContext& ctx, Ripple2DState& s);
+void pattern_starfield(CRGB* leds, int activeLeds, const FrameContext& ctx, StarfieldState& s);
+void pattern_side_fire(CRGB* leds, int activeLeds, const FrameContext& ctx, SideFireState& s);
+void pattern_scrolling_rainbow(CRGB* leds, int activeLeds, const FrameContext& ctx, ScrollingRainbowState& s);
+void pattern_particle_fountain(CRGB* leds, int activeLeds, const FrameContext& ctx, ParticleFountainState& s);
+void pattern_scrolling_text(CRGB* leds, int activeLeds, const FrameContext& ctx,
+                            const char* text, int& scrollOffset, int scrollSpeed,
+                            ScrollingTextState& s);
+void pattern_test_card(CRGB* leds, int activeLeds, const FrameContext& ctx, TestCardState& s);
+void pattern_custom(CRGB* leds, int activeLeds, const FrameContext& ctx, const CRGB* custom, int scrollMs, CustomFrameState& s);
+void pattern_flipbook(CRGB* leds, int activeLeds, const FrameContext& ctx, FlipbookPlayer* book, FlipbookState& s);
+
+#ifndef SIMULATOR
+// 1D strip patterns (patterns/patterns_1d.cpp), firmware only
+
+// Shared by patterns whose only state is a timer, a position or a timestamp
+struct StripTimerState {
+  PatternTimer timer;
+};
+
+struct StripPositionState {
+  int pos = 0;
+};
+
+struct StripTimestampState {
+  unsigned long last = 0;
+};
+
+struct StripFireState {
+  uint8_t heat[MAX_LEDS];
+};
+
+struct StripBouncingBallsState {
+  float positions[3];
+  float velocities[3];
+  bool started = false;
+};
+
+struct StripTrafficLightState {
+  unsigned long lastChange = 0;
+  int phase = 0;
+};
+
+struct StripMorseState {
+  unsigned long lastBlink = 0;
+  int patternIdx = 0;
+};
+
+struct StripWarpSpeedState {
+  int warpPos[10];
+};
+
+struct StripExplosionState {
+  int center = 0;
+  int radius = 0;
+  bool started = false;
+};
+
+struct StripPixelSortState {
+  uint8_t sortPhase = 0;
+  unsigned long lastSwap = 0;
+  bool initialized = false;
+};
+
+struct StripRippleState {
+  int center = 0;
+  bool started = false;
+  PatternTimer move;
+};
+
+struct StripFireworksState {
+  unsigned long lastBurst = 0;
+  int burstPos = 0;
+  int burstPhase = 0;
+};
+
+struct StripCounterState {
+  uint8_t counter = 0;
+  PatternTimer tick;
+};
+
+struct StripBouncingBallState {
+  float ballPos = 0;
+  float ballVel = 0;
+  PatternTimer hueStep;
+};
+
+struct StripHotSpotState {
+  int hotSpot = 0;
+  unsigned long lastMove = 0;
+};
+
+struct StripSirenState {
+  unsigned long lastSwitch = 0;
+  bool isRed = true;
+};
+
+struct StripWalkerState {
+  int walker = 0;
+  bool started = false;
+};
+
+struct StripSupernovaState {
+  unsigned long lastNova = 0;
+  int novaPhase = 0;
+};
+
+void pattern_1d_rainbow(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_red(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_green(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_blue(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_off(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_confetti(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_sinelon(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_bpm(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_juggle(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_fire(CRGB* leds, int activeLeds, const FrameContext& ctx, StripFireState& s);
+void pattern_1d_rainbow_glitter(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_candy_cane(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_theater_chase(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_matrix_rain(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_twinkle(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_police_lights(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_running_lights(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_snow_sparkle(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_color_wipe(CRGB* leds, int activeLeds, const FrameContext& ctx, StripPositionState& s);
+void pattern_1d_color_pulse(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_lightning(CRGB* leds, int activeLeds, const FrameContext& ctx, StripTimestampState& s);
+void pattern_1d_ocean_waves(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_lava_lamp(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_meteor_rain(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_pride(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_heartbeat(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_comet(CRGB* leds, int activeLeds, const FrameContext& ctx, StripPositionState& s);
+void pattern_1d_gradient(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_random_colors(CRGB* leds, int activeLeds, const FrameContext& ctx, StripTimerState& s);
+void pattern_1d_knight_rider(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_breathing(CRGB* leds, int activeLeds, const FrameContext& ctx, StripTimerState& s);
+void pattern_1d_strobe(CRGB* leds, int activeLeds, const FrameContext& ctx, StripTimestampState& s);
+void pattern_1d_pac_man(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_bouncing_balls(CRGB* leds, int activeLeds, const FrameContext& ctx, StripBouncingBallsState& s);
+void pattern_1d_usa_flag(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_christmas(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_plasma(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_scanner(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_sparkle(CRGB* leds, int activeLeds, const FrameContext& ctx, StripTimerState& s);
+void pattern_1d_color_chase(CRGB* leds, int activeLeds, const FrameContext& ctx, StripPositionState& s);
+void pattern_1d_rainbow_wave(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_dragon_breath(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_aurora(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_disco_ball(CRGB* leds, int activeLeds, const FrameContext& ctx, StripTimerState& s);
+void pattern_1d_waterfall(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_neon_signs(CRGB* leds, int activeLeds, const FrameContext& ctx, StripTimerState& s);
+void pattern_1d_traffic_light(CRGB* leds, int activeLeds, const FrameContext& ctx, StripTrafficLightState& s);
+void pattern_1d_binary_code(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_rave(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_sunset(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_campfire(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_sparkler(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_lighthouse(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_sos_morse_code(CRGB* leds, int activeLeds, const FrameContext& ctx, StripMorseState& s);
+void pattern_1d_meteor_shower(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_rainbow_spiral(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_lava_flow(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_ice_cave(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_fireflies(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_circus(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_warp_speed(CRGB* leds, int activeLeds, const FrameContext& ctx, StripWarpSpeedState& s);
+void pattern_1d_radar_sweep(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_equalizer_bars(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_snake(CRGB* leds, int activeLeds, const FrameContext& ctx, StripPositionState& s);
+void pattern_1d_pulse_wave(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_color_explosion(CRGB* leds, int activeLeds, const FrameContext& ctx, StripExplosionState& s);
+void pattern_1d_digital_rain(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_heartbeat_wave(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_thunderstorm(CRGB* leds, int activeLeds, const FrameContext& ctx, StripTimestampState& s);
+void pattern_1d_rainbow_fade(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_disco_strobe(CRGB* leds, int activeLeds, const FrameContext& ctx, StripTimestampState& s);
+void pattern_1d_biohazard(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_ocean_depth(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_pixel_sort(CRGB* leds, int activeLeds, const FrameContext& ctx, StripPixelSortState& s);
+void pattern_1d_glitch(CRGB* leds, int activeLeds, const FrameContext& ctx, StripTimestampState& s);
+void pattern_1d_tron(CRGB* leds, int activeLeds, const FrameContext& ctx, StripPositionState& s);
+void pattern_1d_ember(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_aurora_borealis(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_neon_pulse(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_rainbow_ripple(CRGB* leds, int activeLeds, const FrameContext& ctx, StripRippleState& s);
+void pattern_1d_kaleidoscope(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_dna_helix(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_fireworks(CRGB* leds, int activeLeds, const FrameContext& ctx, StripFireworksState& s);
+void pattern_1d_vu_meter(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_spinning_wheel(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_color_bands(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_starfield(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_binary_counter(CRGB* leds, int activeLeds, const FrameContext& ctx, StripCounterState& s);
+void pattern_1d_breathing_rainbow(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_wave_interference(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_bouncing_ball(CRGB* leds, int activeLeds, const FrameContext& ctx, StripBouncingBallState& s);
+void pattern_1d_color_temperature(CRGB* leds, int activeLeds, const FrameContext& ctx, StripHotSpotState& s);
+void pattern_1d_police_siren(CRGB* leds, int activeLeds, const FrameContext& ctx, StripSirenState& s);
+void pattern_1d_candy_stripes(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_pixel_rain(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_energy_field(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_orbit(CRGB* leds, int activeLeds, const FrameContext& ctx);
+void pattern_1d_pulse_ring(CRGB* leds, int activeLeds, const FrameContext& ctx, StripPositionState& s);
+void pattern_1d_random_walk(CRGB* leds, int activeLeds, const FrameContext& ctx, StripWalkerState& s);
+void pattern_1d_supernova(CRGB* leds, int activeLeds, const FrameContext& ctx, StripSupernovaState& s);
+#endif // SIMULATOR
 
 #endif // PATTERNS_H
@@ -0,0 +1,66 @@
+// led_map.cpp - Grid -> strip lookup table (see led_map.h)
+#include "../led_map.h"
+
+uint16_t ledMap[GRID_LEDS];
+
+static uint8_t currentLayout = LAYOUT_ZIGZAG_ROWS;
+static uint8_t currentOrientation = ORIENT_NORMAL;
+static bool rowsContiguous = true;
+
+// Strip index of physical cell (x, y) for a given wiring.
+static uint16_t stripIndex(uint8_t layout, int x, int y) {
+  switch (layout) {
+    case LAYOUT_PROGRESSIVE_ROWS:
+      return y * GRID_WIDTH + x;
+    case LAYOUT_SERPENTINE_COLUMNS:
+      return x * GRID_HEIGHT + ((x & 1) ? (GRID_HEIGHT - 1 - y) : y);
+    case LAYOUT_PROGRESSIVE_COLUMNS:
+      return x * GRID_HEIGHT + y;
+    case LAYOUT_ZIGZAG_ROWS:
+    default:
+      return y * GRID_WIDTH + ((y & 1) ? (GRID_WIDTH - 1 - x) : x);
+  }
+}
+
+void ledMapInit(uint8_t layout, uint8_t orientation) {
+  if (layout >= LAYOUT_COUNT) layout = LAYOUT_ZIGZAG_ROWS;
+  orientation &= ORIENT_ROTATE_180;
+
+  for (int y = 0; y < GRID_HEIGHT; y++) {
+    int py = (orientation & ORIENT_MIRROR_Y) ? (GRID_HEIGHT - 1 - y) : y;
+    for (int x = 0; x < GRID_WIDTH; x++) {
+      int px = (orientation & ORIENT_MIRROR_X) ? (GRID_WIDTH - 1 - x) : x;
+      ledMap[y * GRID_WIDTH + x] = stripIndex(layout, px, py);
+    }
+  }
+
+  rowsContiguous = true;
+  for (int y = 0; y < GRID_HEIGHT && rowsContiguous; y++) {
+    const uint16_t* row = xyRow(y);
+    int step = xyRowStep(y);
+    for (int x = 1; x < GRID_WIDTH; x++) {
+      if ((int)row[x] - (int)row[x - 1] != step || (step != 1 && step != -1)) {
+        rowsContiguous = false;
+        break;
+      }
+    }
+  }
+
+  currentLayout = layout;
+  currentOrientation = orientation;
+}
+
+uint8_t ledMapLayout() {
+  return currentLayout;
+}
+
+uint8_t ledMapOrientation() {
+  return currentOrientation;
+}
+
+bool ledMapRowsContiguous() {
+  return rowsContiguous;
+}
+
+// Build the boot-time table before anything renders (setup()/sim_init may rebuild it).
+static const bool ledMapReady = (ledMapInit(LED_LAYOUT, LED_ORIENTATION), true);
@@ -0,0 +1,220 @@
+// noise_field.cpp - FastLED-compatible gradient noise (see noise_field.h)
+#include "../noise_field.h"
+
+// Ken Perlin's permutation table, with p[256] = p[0] so P(i + 1) never needs a mask
+static const uint8_t p[] PROGMEM = {
+  151, 160, 137, 91, 90, 15, 131, 13, 201, 95, 96, 53, 194, 233, 7, 225, 140, 36, 103, 30, 69,
+  142, 8, 99, 37, 240, 21, 10, 23, 190, 6, 148, 247, 120, 234, 75, 0, 26, 197, 62, 94, 252, 219,
+  203, 117, 35, 11, 32, 57, 177, 33, 88, 237, 149, 56, 87, 174, 20, 125, 136, 171, 168, 68, 175,
+  74, 165, 71, 134, 139, 48, 27, 166, 77, 146, 158, 231, 83, 111, 229, 122, 60, 211, 133, 230,
+  220, 105, 92, 41, 55, 46, 245, 40, 244, 102, 143, 54, 65, 25, 63, 161, 1, 216, 80, 73, 209,
+  76, 132, 187, 208, 89, 18, 169, 200, 196, 135, 130, 116, 188, 159, 86, 164, 100, 109, 198,
+  173, 186, 3, 64, 52, 217, 226, 250, 124, 123, 5, 202, 38, 147, 118, 126, 255, 82, 85, 212,
+  207, 206, 59, 227, 47, 16, 58, 17, 182, 189, 28, 42, 223, 183, 170, 213, 119, 248, 152, 2, 44,
+  154, 163, 70, 221, 153, 101, 155, 167, 43, 172, 9, 129, 22, 39, 253, 19, 98, 108, 110, 79,
+  113, 224, 232, 178, 185, 112, 104, 218, 246, 97, 228, 251, 34, 242, 193, 238, 210, 144, 12,
+  191, 179, 162, 241, 81, 51, 145, 235, 249, 14, 239, 107, 49, 192, 214, 31, 181, 199, 106, 157,
+  184, 84, 204, 176, 115, 121, 50, 45, 127, 4, 150, 254, 138, 236, 205, 93, 222, 114, 67, 29,
+  24, 72, 243, 141, 128, 195, 78, 66, 215, 61, 156, 180, 151
+};
+
+#define P(x) pgm_read_byte(&p[(x)])
+
+static inline int8_t grad8(uint8_t hash, int8_t x, int8_t y, int8_t z) {
+  hash &= 0xF;
+  int8_t u = (hash & 8) ? y : x;
+  int8_t v = hash < 4 ? y : (hash == 12 || hash == 14) ? x : z;
+  if (hash & 1) u = -u;
+  if (hash & 2) v = -v;
+  return avg7(u, v);
+}
+
+// Gradient hashes of the 8 corners of lattice cell (X, Y, Z)
+static inline void cornerHashes(uint8_t X, uint8_t Y, uint8_t Z, uint8_t* h) {
+  uint8_t A = P(X) + Y;
+  uint8_t AA = P(A) + Z;
+  uint8_t AB = P(A + 1) + Z;
+  uint8_t B = P(X + 1) + Y;
+  uint8_t BA = P(B) + Z;
+  uint8_t BB = P(B + 1) + Z;
+  h[0] = P(AA);
+  h[1] = P(BA);
+  h[2] = P(AB);
+  h[3] = P(BB);
+  h[4] = P(AA + 1);
+  h[5] = P(BA + 1);
+  h[6] = P(AB + 1);
+  h[7] = P(BB + 1);
+}
+
+// inoise8_raw for one point, given its cell hashes, signed fractions and eased fractions
+static inline int8_t noiseCell(const uint8_t* h, int8_t xx, int8_t yy, int8_t zz,
+                               uint8_t u, uint8_t v, uint8_t w) {
+  const uint8_t N = 0x80;
+  int8_t X1 = lerp7by8(grad8(h[0], xx, yy, zz), grad8(h[1], xx - N, yy, zz), u);
+  int8_t X2 = lerp7by8(grad8(h[2], xx, yy - N, zz), grad8(h[3], xx - N, yy - N, zz), u);
+  int8_t X3 = lerp7by8(grad8(h[4], xx, yy, zz - N), grad8(h[5], xx - N, yy, zz - N), u);
+  int8_t X4 = lerp7by8(grad8(h[6], xx, yy - N, zz - N), grad8(h[7], xx - N, yy - N, zz - N), u);
+  int8_t Y1 = lerp7by8(X1, X2, v);
+  int8_t Y2 = lerp7by8(X3, X4, v);
+  return lerp7by8(Y1, Y2, w);
+}
+
+// -64..64 -> 0..255, as FastLED's inoise8
+static inline uint8_t noiseToU8(int8_t n) {
+  n += 64;
+  return qadd8(n, n);
+}
+
+NoiseField8::NoiseField8(uint16_t x0, uint16_t dx, uint16_t y0, uint16_t dy)
+    : x0_(x0), dx_(dx), y0_(y0), dy_(dy), axesReady_(false), runCount_(0), cachedZ_(-1) {}
+
+void NoiseField8::buildAxes() {
+  runCount_ = 0;
+  int lastCell = -1;
+  for (int x = 0; x < GRID_WIDTH; x++) {
+    uint16_t px = x0_ + x * dx_;
+    uint8_t cell = px >> 8;
+    if (cell != lastCell) {
+      if (runCount_ < kMaxRuns) runCell_[runCount_] = cell;
+      runCount_++;
+      lastCell = cell;
+    }
+    colRun_[x] = (runCount_ - 1) < kMaxRuns ? (runCount_ - 1) : 0;
+    colEase_[x] = ease8InOutQuad((uint8_t)px);
+    colFrac_[x] = ((uint8_t)px >> 1) & 0x7F;
+  }
+  for (int y = 0; y < GRID_HEIGHT; y++) {
+    uint16_t py = y0_ + y * dy_;
+    rowCell_[y] = py >> 8;
+    rowEase_[y] = ease8InOutQuad((uint8_t)py);
+    rowFrac_[y] = ((uint8_t)py >> 1) & 0x7F;
+  }
+  axesReady_ = true;
+  cachedZ_ = -1;
+}
+
+void NoiseField8::fill(uint8_t* out, uint16_t z) {
+  if (!axesReady_) buildAxes();
+
+  uint8_t Z = z >> 8;
+  uint8_t w = ease8InOutQuad((uint8_t)z);
+  int8_t zz = ((uint8_t)z >> 1) & 0x7F;
+
+  // With too many cells per row (large dx) fall back to hashing per cell, per frame.
+  bool cacheable = runCount_ <= kMaxRuns;
+  bool refresh = cachedZ_ != Z;
+
+  for (int y = 0; y < GRID_HEIGHT; y++) {
+    uint8_t Y = rowCell_[y];
+    uint8_t v = rowEase_[y];
+    int8_t yy = rowFrac_[y];
+    uint8_t* dst = out + y * GRID_WIDTH;
+
+    if (cacheable) {
+      if (refresh) {
+        for (int r = 0; r < runCount_; r++) {
+          cornerHashes(runCell_[r], Y, Z, hashes_[y][r]);
+        }
+      }
+      for (int x = 0; x < GRID_WIDTH; x++) {
+        dst[x] = noiseToU8(noiseCell(hashes_[y][colRun_[x]], colFrac_[x], yy, zz, colEase_[x], v, w));
+      }
+    } else {
+      uint8_t h[8];
+      int lastCell = -1;
+      for (int x = 0; x < GRID_WIDTH; x++) {
+        uint8_t cell = (uint16_t)(x0_ + x * dx_) >> 8;
+        if (cell != lastCell) {
+          cornerHashes(cell, Y, Z, h);
+          lastCell = cell;
+        }
+        dst[x] = noiseToU8(noiseCell(h, colFrac_[x], yy, zz, colEase_[x], v, w));
+      }
+    }
+  }
+  cachedZ_ = cacheable ? Z : -1;
+}
+
+#ifdef SIMULATOR
+
+uint8_t inoise8(uint16_t x, uint16_t y, uint16_t z) {
+  uint8_t h[8];
+  cornerHashes(x >> 8, y >> 8, z >> 8, h);
+  int8_t xx = ((uint8_t)x >> 1) & 0x7F;
+  int8_t yy = ((uint8_t)y >> 1) & 0x7F;
+  int8_t zz = ((uint8_t)z >> 1) & 0x7F;
+  return noiseToU8(noiseCell(h, xx, yy, zz, ease8InOutQuad(x), ease8InOutQuad(y), ease8InOutQuad(z)));
+}
+
+static inline int8_t grad8(uint8_t hash, int8_t x, int8_t y) {
+  int8_t u, v;
+  if (hash & 4) {
+    u = y; v = x;
+  } else {
+    u = x; v = y;
+  }
+  if (hash & 1) u = -u;
+  if (hash & 2) v = -v;
+  return avg7(u, v);
+}
+
+uint8_t inoise8(uint16_t x, uint16_t y) {
+  uint8_t X = x >> 8;
+  uint8_t Y = y >> 8;
+  uint8_t A = P(X) + Y;
+  uint8_t AA = P(A);
+  uint8_t AB = P(A + 1);
+  uint8_t B = P(X + 1) + Y;
+  uint8_t BA = P(B);
+  uint8_t BB = P(B + 1);
+
+  int8_t xx = ((uint8_t)x >> 1) & 0x7F;
+  int8_t yy = ((uint8_t)y >> 1) & 0x7F;
+  const uint8_t N = 0x80;
+  uint8_t u = ease8InOutQuad(x);
+  uint8_t v = ease8InOutQuad(y);
+
+  int8_t X1 = lerp7by8(grad8(P(AA), xx, yy), grad8(P(BA), xx - N, yy), u);
+  int8_t X2 = lerp7by8(grad8(P(AB), xx, yy - N), grad8(P(BB), xx - N, yy - N), u);
+  return noiseToU8(lerp7by8(X1, X2, v));
+}
+
+static inline int16_t grad16(uint8_t hash, int16_t x, int16_t y, int16_t z) {
+  hash &= 15;
+  int16_t u = hash < 8 ? x : y;
+  int16_t v = hash < 4 ? y : (hash == 12 || hash == 14) ? x : z;
+  if (hash & 1) u = -u;
+  if (hash & 2) v = -v;
+  return avg15(u, v);
+}
+
+uint16_t inoise16(uint32_t x, uint32_t y, uint32_t z) {
+  uint8_t h[8];
+  cornerHashes((x >> 16) & 0xFF, (y >> 16) & 0xFF, (z >> 16) & 0xFF, h);
+
+  uint16_t u = x & 0xFFFF;
+  uint16_t v = y & 0xFFFF;
+  uint16_t w = z & 0xFFFF;
+  int16_t xx = (u >> 1) & 0x7FFF;
+  int16_t yy = (v >> 1) & 0x7FFF;
+  int16_t zz = (w >> 1) & 0x7FFF;
+  const uint16_t N = 0x8000;
+  u = ease16InOutQuad(u);
+  v = ease16InOutQuad(v);
+  w = ease16InOutQuad(w);
+
+  int16_t X1 = lerp15by16(grad16(h[0], xx, yy, zz), grad16(h[1], xx - N, yy, zz), u);
+  int16_t X2 = lerp15by16(grad16(h[2], xx, yy - N, zz), grad16(h[3], xx - N, yy - N, zz), u);
+  int16_t X3 = lerp15by16(grad16(h[4], xx, yy, zz - N), grad16(h[5], xx - N, yy, zz - N), u);
+  int16_t X4 = lerp15by16(grad16(h[6], xx, yy - N, zz - N), grad16(h[7], xx - N, yy - N, zz - N), u);
+  int16_t Y1 = lerp15by16(X1, X2, v);
+  int16_t Y2 = lerp15by16(X3, X4, v);
+  int32_t ans = lerp15by16(Y1, Y2, w);
+
+  uint32_t pan = ans + 19052L;
+  pan *= 440L;
+  return pan >> 8;
+}
+
+#endif // SIMULATOR
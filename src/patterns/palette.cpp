@@ -0,0 +1,138 @@
+// palette.cpp - Color schemes and their 256-entry tables (see palette.h)
+#include "../palette.h"
+
+namespace {
+
+// 16 colors per scheme (0xRRGGBB), entry k at index k * 16. The values are FastLED's
+// built-in palettes of the same names, so schemes look as they do in FastLED sketches.
+const uint32_t kParty[16] PROGMEM = {
+  0x5500AB, 0x84007C, 0xB5004B, 0xE5001B, 0xE81700, 0xB84700, 0xAB7700, 0xABAB00,
+  0xAB5500, 0xDD2200, 0xF2000E, 0xC2003E, 0x8F0071, 0x5F00A1, 0x2F00D0, 0x0007F9,
+};
+const uint32_t kOcean[16] PROGMEM = {
+  0x191970, 0x00008B, 0x191970, 0x000080, 0x00008B, 0x0000CD, 0x2E8B57, 0x008080,
+  0x5F9EA0, 0x0000FF, 0x008B8B, 0x6495ED, 0x7FFFD4, 0x2E8B57, 0x00FFFF, 0x87CEFA,
+};
+const uint32_t kLava[16] PROGMEM = {
+  0x000000, 0x800000, 0x000000, 0x800000, 0x8B0000, 0x8B0000, 0x800000, 0x8B0000,
+  0x8B0000, 0x8B0000, 0xFF0000, 0xFFA500, 0xFFFFFF, 0xFFA500, 0xFF0000, 0x8B0000,
+};
+const uint32_t kForest[16] PROGMEM = {
+  0x006400, 0x006400, 0x556B2F, 0x006400, 0x008000, 0x228B22, 0x6B8E23, 0x008000,
+  0x2E8B57, 0x66CDAA, 0x32CD32, 0x9ACD32, 0x90EE90, 0x7CFC00, 0x66CDAA, 0x228B22,
+};
+const uint32_t kCloud[16] PROGMEM = {
+  0x0000FF, 0x00008B, 0x00008B, 0x00008B, 0x00008B, 0x00008B, 0x00008B, 0x00008B,
+  0x0000FF, 0x00008B, 0x87CEEB, 0x87CEEB, 0xADD8E6, 0xFFFFFF, 0xADD8E6, 0x87CEEB,
+};
+const uint32_t kHeat[16] PROGMEM = {
+  0x000000, 0x330000, 0x660000, 0x990000, 0xCC0000, 0xFF0000, 0xFF3300, 0xFF6600,
+  0xFF9900, 0xFFCC00, 0xFFFF00, 0xFFFF33, 0xFFFF66, 0xFFFF99, 0xFFFFCC, 0xFFFFFF,
+};
+
+const char kNameRainbow[] PROGMEM = "Rainbow";
+const char kNameParty[] PROGMEM = "Party";
+const char kNameOcean[] PROGMEM = "Ocean";
+const char kNameLava[] PROGMEM = "Lava";
+const char kNameForest[] PROGMEM = "Forest";
+const char kNameCloud[] PROGMEM = "Cloud";
+const char kNameHeat[] PROGMEM = "Heat";
+
+struct Scheme {
+  const char* name;
+  const uint32_t* colors;  // nullptr: the HSV rainbow
+};
+
+const Scheme kSchemes[] PROGMEM = {
+  { kNameRainbow, nullptr },
+  { kNameParty, kParty },
+  { kNameOcean, kOcean },
+  { kNameLava, kLava },
+  { kNameForest, kForest },
+  { kNameCloud, kCloud },
+  { kNameHeat, kHeat },
+};
+
+const int kSchemeCount = sizeof(kSchemes) / sizeof(kSchemes[0]);
+
+bool schemeAt(int id, Scheme& out) {
+  if (id < 0 || id >= kSchemeCount) return false;
+  memcpy_P(&out, &kSchemes[id], sizeof(Scheme));
+  return true;
+}
+
+// Moves a toward b by at most `step`
+inline uint8_t approach(uint8_t a, uint8_t b, uint8_t step) {
+  if (a < b) return (b - a > step) ? a + step : b;
+  return (a - b > step) ? a - step : b;
+}
+
+} // namespace
+
+PaletteEngine::PaletteEngine() : id_(0), blending_(false), lastMs_(0) {
+  expand(0, target_);
+  memcpy(current_, target_, sizeof(current_));
+}
+
+int PaletteEngine::count() {
+  return kSchemeCount;
+}
+
+const char* PaletteEngine::name(int id) {
+  Scheme s;
+  return schemeAt(id, s) ? s.name : nullptr;
+}
+
+void PaletteEngine::expand(int id, CRGB* out) {
+  Scheme s;
+  if (!schemeAt(id, s)) return;
+  if (!s.colors) {
+    for (int i = 0; i < 256; i++) out[i] = CHSV((uint8_t)i, 255, 255);
+    return;
+  }
+  uint32_t colors[16];
+  memcpy_P(colors, s.colors, sizeof(colors));
+  for (int k = 0; k < 16; k++) {
+    uint32_t a = colors[k];
+    uint32_t b = colors[(k + 1) & 15];
+    for (int f = 0; f < 16; f++) {
+      uint8_t w = f << 4;  // weight of the next entry
+      uint8_t keep = 255 - w;
+      out[k * 16 + f] = CRGB(scale8(a >> 16, keep) + scale8(b >> 16, w),
+                             scale8(a >> 8, keep) + scale8(b >> 8, w),
+                             scale8(a, keep) + scale8(b, w));
+    }
+  }
+}
+
+bool PaletteEngine::select(int id, bool blend) {
+  if (id < 0 || id >= kSchemeCount) return false;
+  expand(id, target_);
+  id_ = id;
+  if (blend) {
+    blending_ = true;
+  } else {
+    memcpy(current_, target_, sizeof(current_));
+    blending_ = false;
+  }
+  return true;
+}
+
+void PaletteEngine::update(unsigned long nowMs) {
+  unsigned long elapsed = nowMs - lastMs_;
+  lastMs_ = nowMs;
+  if (!blending_) return;
+  // Rounded up, so the steps of any split of kBlendMs add up to a full swing
+  uint32_t step = ((uint32_t)(elapsed < kBlendMs ? elapsed : kBlendMs) * 255 + kBlendMs - 1) / kBlendMs;
+  if (step == 0) step = 1;
+  bool done = true;
+  for (int i = 0; i < 256; i++) {
+    CRGB& c = current_[i];
+    const CRGB& t = target_[i];
+    c.r = approach(c.r, t.r, step);
+    c.g = approach(c.g, t.g, step);
+    c.b = approach(c.b, t.b, step);
+    done = done && c.r == t.r && c.g == t.g && c.b == t.b;
+  }
+  blending_ = !done;
+}
@@ -2,13 +2,14 @@
 #include "../patterns.h"
 
 // Horizontal Bars - Each strip a different cycling color
-void pattern_horizontal_bars(CRGB* leds, int activeLeds, uint8_t& hue) {
+void pattern_horizontal_bars(CRGB* leds, int activeLeds, const FrameContext& ctx) {
 for(int y=0; y<GRID_HEIGHT; y++) {
-          uint8_t stripHue = (hue + y * 28) % 256;
+          uint8_t stripHue = (ctx.hue + y * 28) % 256;
+          const CRGB color = ctx.palette[stripHue];
+          const uint16_t* row = xyRow(y);
           for(int x=0; x<GRID_WIDTH; x++) {
-            int led = XY(x, y);
-            if (led >= 0) leds[led] = CHSV(stripHue, 255, 255);
+            leds[row[x]] = color;
           }
         }
-        hue++;
+        ctx.hue += ctx.steps;
 }
@@ -2,13 +2,14 @@
 #include "../patterns.h"
 
 // Vertical Ripple - Waves moving vertically
-void pattern_vertical_ripple(CRGB* leds, int activeLeds, uint8_t& hue) {
+void pattern_vertical_ripple(CRGB* leds, int activeLeds, const FrameContext& ctx) {
 for(int y=0; y<GRID_HEIGHT; y++) {
           uint8_t brightness = beatsin8(20, 0, 255, 0, y*32);
+          const CRGB color = paletteColor(ctx.palette, ctx.hue, brightness);
+          const uint16_t* row = xyRow(y);
           for(int x=0; x<GRID_WIDTH; x++) {
-            int led = XY(x, y);
-            if (led >= 0) leds[led] = CHSV(hue, 255, brightness);
+            leds[row[x]] = color;
           }
         }
-        hue++;
+        ctx.hue += ctx.steps;
 }
@@ -2,18 +2,17 @@
 #include "../patterns.h"
 
 // Vertical Equalizer - Each strip is a bar
-void pattern_vertical_equalizer(CRGB* leds, int activeLeds, uint8_t& hue) {
+void pattern_vertical_equalizer(CRGB* leds, int activeLeds, const FrameContext& ctx) {
 for(int y=0; y<GRID_HEIGHT; y++) {
           int barHeight = beatsin8(40 + y*5, 0, GRID_WIDTH);
+          const uint16_t* row = xyRow(y);
           for(int x=0; x<GRID_WIDTH; x++) {
-            int led = XY(x, y);
-            if (led >= 0) {
-              if (x < barHeight) {
-                uint8_t barHue = (y * 255) / GRID_HEIGHT;
-                leds[led] = CHSV(barHue, 255, 255);
-              } else {
-                leds[led] = CRGB::Black;
-              }
+            int led = row[x];
+            if (x < barHeight) {
+              uint8_t barHue = (y * 255) / GRID_HEIGHT;
+              leds[led] = ctx.palette[barHue];
+            } else {
+              leds[led] = CRGB::Black;
             }
           }
         }
@@ -2,18 +2,19 @@
 #include "../patterns.h"
 
 // Scanning Lines - Horizontal lines moving up/down
-void pattern_scanning_lines(CRGB* leds, int activeLeds, uint8_t& hue) {
-static int scanLine = 0;
+void pattern_scanning_lines(CRGB* leds, int activeLeds, const FrameContext& ctx, ScanningLinesState& s) {
+          int& scanLine = s.scanLine;
           fill_solid(leds, activeLeds, CRGB::Black);
+          const uint16_t* row = xyRow(scanLine);
+          const uint16_t* trail = xyRow((scanLine + 1) % GRID_HEIGHT);
+          const CRGB color = ctx.palette[ctx.hue];
+          const CRGB trailColor = paletteColor(ctx.palette, ctx.hue, 128);
           for(int x=0; x<GRID_WIDTH; x++) {
-            int led = XY(x, scanLine);
-            if (led >= 0) leds[led] = CHSV(hue, 255, 255);
+            leds[row[x]] = color;
             // Add trail
-            int led2 = XY(x, (scanLine + 1) % GRID_HEIGHT);
-            if (led2 >= 0) leds[led2] = CHSV(hue, 255, 128);
-          }
-          EVERY_N_MILLISECONDS(100) {
-            scanLine = (scanLine + 1) % GRID_HEIGHT;
-            hue += 5;
+            leds[trail[x]] = trailColor;
           }
+          uint16_t lines = s.step.every(ctx.now, 100);
+          scanLine = (scanLine + lines) % GRID_HEIGHT;
+          ctx.hue += 5 * lines;
 }
@@ -2,20 +2,20 @@
 #include "../patterns.h"
 
 // Checkerboard - Classic 2D pattern
-void pattern_checkerboard(CRGB* leds, int activeLeds, uint8_t& hue) {
+void pattern_checkerboard(CRGB* leds, int activeLeds, const FrameContext& ctx) {
 int cellSize = 8;
+          const CRGB color = ctx.palette[ctx.hue];
           for(int y=0; y<GRID_HEIGHT; y++) {
+            const uint16_t* row = xyRow(y);
             for(int x=0; x<GRID_WIDTH; x++) {
-              int led = XY(x, y);
-              if (led >= 0) {
-                bool isWhite = ((x/cellSize) + (y)) % 2 == (hue/50) % 2;
-                if (isWhite) {
-                  leds[led] = CHSV(hue, 255, 255);
-                } else {
-                  leds[led] = CRGB::Black;
-                }
+              int led = row[x];
+              bool isWhite = ((x/cellSize) + (y)) % 2 == (ctx.hue/50) % 2;
+              if (isWhite) {
+                leds[led] = color;
+              } else {
+                leds[led] = CRGB::Black;
               }
             }
           }
-          hue++;
+          ctx.hue += ctx.steps;
 }
@@ -2,15 +2,14 @@
 #include "../patterns.h"
 
 // Diagonal Sweep - Diagonal lines moving
-void pattern_diagonal_sweep(CRGB* leds, int activeLeds, uint8_t& hue) {
+void pattern_diagonal_sweep(CRGB* leds, int activeLeds, const FrameContext& ctx) {
 for(int y=0; y<GRID_HEIGHT; y++) {
+          const uint16_t* row = xyRow(y);
           for(int x=0; x<GRID_WIDTH; x++) {
-            int led = XY(x, y);
-            if (led >= 0) {
-              uint8_t dist = (x + y*10 + hue*2) % 256;
-              leds[led] = CHSV(dist, 255, sin8(dist));
-            }
+            int led = row[x];
+            uint8_t dist = (x + y*10 + ctx.hue*2) % 256;
+            leds[led] = paletteColor(ctx.palette, dist, sin8(dist));
           }
         }
-        hue++;
+        ctx.hue += ctx.steps;
 }
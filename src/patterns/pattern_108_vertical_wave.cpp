@@ -2,17 +2,16 @@
 #include "../patterns.h"
 
 // Vertical Wave - Sine wave across strips
-void pattern_vertical_wave(CRGB* leds, int activeLeds, uint8_t& hue) {
+void pattern_vertical_wave(CRGB* leds, int activeLeds, const FrameContext& ctx) {
 for(int y=0; y<GRID_HEIGHT; y++) {
           uint8_t yPos = beatsin8(15, 0, GRID_WIDTH-1, 0, y*20);
+          const uint16_t* row = xyRow(y);
           for(int x=0; x<GRID_WIDTH; x++) {
-            int led = XY(x, y);
-            if (led >= 0) {
-              int dist = abs(x - yPos);
-              uint8_t brightness = dist < 5 ? 255 - (dist*50) : 0;
-              leds[led] = CHSV(hue + y*28, 255, brightness);
-            }
+            int led = row[x];
+            int dist = abs(x - yPos);
+            uint8_t brightness = dist < 5 ? 255 - (dist*50) : 0;
+            leds[led] = paletteColor(ctx.palette, ctx.hue + y*28, brightness);
           }
         }
-        hue++;
+        ctx.hue += ctx.steps;
 }
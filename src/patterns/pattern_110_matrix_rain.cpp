@@ -2,27 +2,29 @@
 #include "../patterns.h"
 
 // Matrix Rain 2D - Proper Matrix effect with columns
-void pattern_matrix_rain(CRGB* leds, int activeLeds, uint8_t& hue) {
-static uint8_t drops[GRID_WIDTH];
-          static bool initialized110 = false;
+void pattern_matrix_rain(CRGB* leds, int activeLeds, const FrameContext& ctx, MatrixRainState& s) {
+          uint8_t* drops = s.drops;
 
-          if (!initialized110) {
+          if (!s.started) {
             for(int x=0; x<GRID_WIDTH; x++) {
               drops[x] = random8(GRID_HEIGHT);
             }
-            initialized110 = true;
+            s.started = true;
           }
 
-          fadeToBlackBy(leds, activeLeds, 40);
+          // One fade and one move per step; the heads drawn in between make the trail
+          for(uint8_t n=0; n<ctx.steps; n++) {
+            fadeToBlackBy(leds, activeLeds, 40);
 
-          for(int x=0; x<GRID_WIDTH; x++) {
-            // Draw the head (bright green)
-            int led = XY(x, drops[x]);
-            if (led >= 0) leds[led] = CRGB::Green;
+            for(int x=0; x<GRID_WIDTH; x++) {
+              // Draw the head (bright green)
+              int led = XY(x, drops[x]);
+              if (led >= 0) leds[led] = CRGB::Green;
 
-            // Move drop down
-            if (random8() < 100) {
-              drops[x] = (drops[x] - 1 + GRID_HEIGHT) % GRID_HEIGHT;
+              // Move drop down
+              if (random8() < 100) {
+                drops[x] = (drops[x] - 1 + GRID_HEIGHT) % GRID_HEIGHT;
+              }
             }
           }
 }
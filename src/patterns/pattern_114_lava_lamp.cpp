@@ -2,18 +2,18 @@
 #include "../patterns.h"
 
 // Lava Lamp 2D - Aspect-ratio corrected blobs
-void pattern_lava_lamp(CRGB* leds, int activeLeds, uint8_t& hue) {
-for(int y=0; y<GRID_HEIGHT; y++) {
-          for(int x=0; x<GRID_WIDTH; x++) {
-            int led = XY(x, y);
-            if (led >= 0) {
-              // Correct for aspect ratio in noise calculation
-              uint8_t blob1 = inoise8(x * 10, y * 70, hue * 2);
-              uint8_t blob2 = inoise8(x * 15, y * 100, hue * 3 + 10000);
-              uint8_t combined = (blob1 + blob2) / 2;
-              leds[led] = HeatColor(combined);
-            }
-          }
-        }
-        hue++;
+void pattern_lava_lamp(CRGB* leds, int activeLeds, const FrameContext& ctx, LavaLampState& s) {
+  s.blob1.fill(s.field1, ctx.hue * 2);
+  s.blob2.fill(s.field2, ctx.hue * 3 + 10000);
+
+  for(int y=0; y<GRID_HEIGHT; y++) {
+    const uint16_t* row = xyRow(y);
+    const uint8_t* b1 = s.field1 + y * GRID_WIDTH;
+    const uint8_t* b2 = s.field2 + y * GRID_WIDTH;
+    for(int x=0; x<GRID_WIDTH; x++) {
+      uint8_t combined = (b1[x] + b2[x]) / 2;
+      leds[row[x]] = HeatColor(combined);
+    }
+  }
+  ctx.hue += ctx.steps;
 }
@@ -2,26 +2,25 @@
 #include "../patterns.h"
 
 // 2D Ripple - Aspect-ratio corrected circles
-void pattern_ripple_2d(CRGB* leds, int activeLeds, uint8_t& hue) {
-static int centerX = GRID_WIDTH / 2;
-          static int centerY = GRID_HEIGHT / 2;
+void pattern_ripple_2d(CRGB* leds, int activeLeds, const FrameContext& ctx, Ripple2DState& s) {
+          int& centerX = s.centerX;
+          int& centerY = s.centerY;
 
           for(int y=0; y<GRID_HEIGHT; y++) {
+            const uint16_t* row = xyRow(y);
             for(int x=0; x<GRID_WIDTH; x++) {
-              int led = XY(x, y);
-              if (led >= 0) {
-                // Calculate distance with aspect ratio correction
-                float dx = (x - centerX);
-                float dy = (y - centerY) * ASPECT_RATIO;
-                float dist = sqrt(dx*dx + dy*dy);
-                uint8_t brightness = sin8((dist * 10) - (hue * 3));
-                leds[led] = CHSV(hue + (dist * 2), 255, brightness);
-              }
+              int led = row[x];
+              // Calculate distance with aspect ratio correction
+              float dx = (x - centerX);
+              float dy = (y - centerY) * ASPECT_RATIO;
+              float dist = sqrt(dx*dx + dy*dy);
+              uint8_t brightness = sin8((dist * 10) - (ctx.hue * 3));
+              leds[led] = paletteColor(ctx.palette, (int)(ctx.hue + (dist * 2)), brightness);
             }
           }
-          hue += 2;
+          ctx.hue += 2 * ctx.steps;
 
-          EVERY_N_SECONDS(5) {
+          if (s.move.every(ctx.now, 5000)) {
             centerX = random16(GRID_WIDTH);
             centerY = random16(GRID_HEIGHT);
           }
@@ -2,33 +2,35 @@
 #include "../patterns.h"
 
 // Starfield Parallax - Stars moving at different speeds
-void pattern_starfield(CRGB* leds, int activeLeds, uint8_t& hue) {
-static float stars[20][3]; // x, y, speed
-          static bool initialized116 = false;
+void pattern_starfield(CRGB* leds, int activeLeds, const FrameContext& ctx, StarfieldState& s) {
+          float (*stars)[3] = s.stars;
 
-          if (!initialized116) {
-            for(int i=0; i<20; i++) {
+          if (!s.started) {
+            for(int i=0; i<StarfieldState::kStars; i++) {
               stars[i][0] = random16(GRID_WIDTH);
               stars[i][1] = random16(GRID_HEIGHT);
               stars[i][2] = random8(1, 5) / 10.0;
             }
-            initialized116 = true;
+            s.started = true;
           }
 
-          fadeToBlackBy(leds, activeLeds, 30);
+          // One fade and one move per step
+          for(uint8_t n=0; n<ctx.steps; n++) {
+            fadeToBlackBy(leds, activeLeds, 30);
 
-          for(int i=0; i<20; i++) {
-            int led = XY((int)stars[i][0], (int)stars[i][1]);
-            if (led >= 0) {
-              uint8_t brightness = 100 + (stars[i][2] * 300);
-              leds[led] = CRGB(brightness, brightness, brightness);
-            }
+            for(int i=0; i<StarfieldState::kStars; i++) {
+              int led = XY((int)stars[i][0], (int)stars[i][1]);
+              if (led >= 0) {
+                uint8_t brightness = 100 + (stars[i][2] * 300);
+                leds[led] = CRGB(brightness, brightness, brightness);
+              }
 
-            // Move star
-            stars[i][0] -= stars[i][2];
-            if (stars[i][0] < 0) {
-              stars[i][0] = GRID_WIDTH - 1;
-              stars[i][1] = random16(GRID_HEIGHT);
+              // Move star
+              stars[i][0] -= stars[i][2];
+              if (stars[i][0] < 0) {
+                stars[i][0] = GRID_WIDTH - 1;
+                stars[i][1] = random16(GRID_HEIGHT);
+              }
             }
           }
 }
@@ -2,41 +2,46 @@
 #include "../patterns.h"
 
 // Side Fire - Fire from left and right edges
-void pattern_side_fire(CRGB* leds, int activeLeds, uint8_t& hue) {
-static byte heatLeft[GRID_HEIGHT][GRID_WIDTH/2];
-          static byte heatRight[GRID_HEIGHT][GRID_WIDTH/2];
+void pattern_side_fire(CRGB* leds, int activeLeds, const FrameContext& ctx, SideFireState& s) {
+          uint8_t (*heatLeft)[GRID_WIDTH/2] = s.heatLeft;
+          uint8_t (*heatRight)[GRID_WIDTH/2] = s.heatRight;
 
-          // Cool down
-          for(int y=0; y<GRID_HEIGHT; y++) {
-            for(int x=0; x<GRID_WIDTH/2; x++) {
-              heatLeft[y][x] = qsub8(heatLeft[y][x], random8(0, 15));
-              heatRight[y][x] = qsub8(heatRight[y][x], random8(0, 15));
+          // One simulation tick per step
+          for(uint8_t n=0; n<ctx.steps; n++) {
+            // Cool down
+            // One row of draws, taken left/right alternately as before
+            uint8_t cooling[GRID_WIDTH];
+            for(int y=0; y<GRID_HEIGHT; y++) {
+              fill_random8(cooling, GRID_WIDTH, 0, 15);
+              for(int x=0; x<GRID_WIDTH/2; x++) {
+                heatLeft[y][x] = qsub8(heatLeft[y][x], cooling[2*x]);
+                heatRight[y][x] = qsub8(heatRight[y][x], cooling[2*x+1]);
+              }
             }
-          }
 
-          // Heat spreads inward
-          for(int y=0; y<GRID_HEIGHT; y++) {
-            for(int x=GRID_WIDTH/2-1; x>0; x--) {
-              heatLeft[y][x] = (heatLeft[y][x-1] + heatLeft[y][x]) / 2;
-              heatRight[y][x] = (heatRight[y][x-1] + heatRight[y][x]) / 2;
+            // Heat spreads inward
+            for(int y=0; y<GRID_HEIGHT; y++) {
+              for(int x=GRID_WIDTH/2-1; x>0; x--) {
+                heatLeft[y][x] = (heatLeft[y][x-1] + heatLeft[y][x]) / 2;
+                heatRight[y][x] = (heatRight[y][x-1] + heatRight[y][x]) / 2;
+              }
             }
-          }
 
-          // Add new fire at edges
-          for(int y=0; y<GRID_HEIGHT; y++) {
-            if(random8() < 120) {
-              heatLeft[y][0] = qadd8(heatLeft[y][0], random8(160, 255));
-              heatRight[y][0] = qadd8(heatRight[y][0], random8(160, 255));
+            // Add new fire at edges
+            for(int y=0; y<GRID_HEIGHT; y++) {
+              if(random8() < 120) {
+                heatLeft[y][0] = qadd8(heatLeft[y][0], random8(160, 255));
+                heatRight[y][0] = qadd8(heatRight[y][0], random8(160, 255));
+              }
             }
           }
 
           // Draw to LEDs
           for(int y=0; y<GRID_HEIGHT; y++) {
+            const uint16_t* row = xyRow(y);
             for(int x=0; x<GRID_WIDTH/2; x++) {
-              int ledLeft = XY(x, y);
-              int ledRight = XY(GRID_WIDTH - 1 - x, y);
-              if (ledLeft >= 0) leds[ledLeft] = HeatColor(heatLeft[y][x]);
-              if (ledRight >= 0) leds[ledRight] = HeatColor(heatRight[y][x]);
+              leds[row[x]] = HeatColor(heatLeft[y][x]);
+              leds[row[GRID_WIDTH - 1 - x]] = HeatColor(heatRight[y][x]);
             }
           }
 }
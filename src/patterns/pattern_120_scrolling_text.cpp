@@ -3,8 +3,9 @@
 #include <string.h>
 
 // Scrolling Text - Aspect-ratio corrected for 7.2:1 physical spacing
-void pattern_scrolling_text(CRGB* leds, int activeLeds, uint8_t& hue,
-                           const char* text, int& scrollOffset, int scrollSpeed) {
+void pattern_scrolling_text(CRGB* leds, int activeLeds, const FrameContext& ctx,
+                            const char* text, int& scrollOffset, int scrollSpeed,
+                            ScrollingTextState& s) {
 fill_solid(leds, activeLeds, CRGB::Black);
 
           // Aspect ratio compensation: vertical is 7.2x taller than horizontal
@@ -22,6 +23,8 @@ fill_solid(leds, activeLeds, CRGB::Black);
           int textLen = strlen(text);
           int textWidth = textLen * charWidth;
 
+          const CRGB color = ctx.palette[ctx.hue];
+
           // Draw each character
           for(int charIdx = 0; charIdx < textLen; charIdx++) {
             char c = text[charIdx];
@@ -48,10 +51,7 @@ fill_solid(leds, activeLeds, CRGB::Black);
 
                         // Only draw if within grid bounds
                         if (y >= 0 && y < GRID_HEIGHT && x >= 0 && x < GRID_WIDTH) {
-                          int led = XY(x, y);
-                          if (led >= 0) {
-                            leds[led] = CHSV(hue, 255, 255);
-                          }
+                          leds[xyRow(y)[x]] = color;
                         }
                       }
                     }
@@ -62,15 +62,11 @@ fill_solid(leds, activeLeds, CRGB::Black);
           }
 
           // Scroll the text using configurable speed
-          static unsigned long lastScrollTime = 0;
-          if (millis() - lastScrollTime > scrollSpeed) {
-            scrollOffset++;
-            // Reset when text has fully scrolled off screen
-            if (scrollOffset > GRID_WIDTH + textWidth) {
-              scrollOffset = 0;
-            }
-            lastScrollTime = millis();
+          scrollOffset += s.scroll.every(ctx.now, scrollSpeed);
+          // Reset when text has fully scrolled off screen
+          if (scrollOffset > GRID_WIDTH + textWidth) {
+            scrollOffset = 0;
           }
 
-          hue++;
+          ctx.hue += ctx.steps;
 }
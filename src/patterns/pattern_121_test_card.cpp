@@ -2,14 +2,14 @@
 #include "../patterns.h"
 
 // Test Card - one lit pixel sweeping across all LEDs to validate mapping/orientation
-void pattern_test_card(CRGB* leds, int activeLeds, uint8_t& hue) {
-  static int pos = 0;
+void pattern_test_card(CRGB* leds, int activeLeds, const FrameContext& ctx, TestCardState& s) {
+  int& pos = s.pos;
   fill_solid(leds, activeLeds, CRGB::Black);
 
   if (pos >= 0 && pos < activeLeds) {
-    leds[pos] = CHSV(hue, 255, 255);  // set one LED bright; change hue for color cycling
+    leds[pos] = ctx.palette[ctx.hue];  // set one LED bright; change ctx.hue for color cycling
   }
 
-  pos = (pos + 1) % activeLeds;
-  hue += 4;
+  pos = (pos + 1) % activeLeds;  // one LED per frame, never skipped, whatever the frame rate
+  ctx.hue += 4 * ctx.steps;
 }
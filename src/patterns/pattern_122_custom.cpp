@@ -0,0 +1,28 @@
+// pattern_122_custom.cpp
+#include "../patterns.h"
+
+// Custom Pattern - shows the frame uploaded from the pattern designer (black until one arrives).
+// With a scroll period (the upload's scrollSpeed) the grid part moves left one column per
+// scrollMs, whatever the frame rate, and wraps around.
+void pattern_custom(CRGB* leds, int activeLeds, const FrameContext& ctx, const CRGB* custom, int scrollMs, CustomFrameState& s) {
+  if (!custom) {
+    fill_solid(leds, activeLeds, CRGB::Black);
+    return;
+  }
+  for (int i = 0; i < activeLeds; i++) {
+    leds[i] = custom[i];
+  }
+  if (scrollMs <= 0) {
+    s.offset = 0;
+    return;
+  }
+  // Several columns per frame when scrollMs is shorter than the 10 fps frame period
+  s.offset = (s.offset + s.scroll.every(ctx.now, scrollMs)) % GRID_WIDTH;
+  for (int y = 0; y < GRID_HEIGHT; y++) {
+    const uint16_t* row = xyRow(y);
+    for (int x = 0; x < GRID_WIDTH; x++) {
+      int dst = row[x];
+      if (dst < activeLeds) leds[dst] = custom[row[(x + s.offset) % GRID_WIDTH]];
+    }
+  }
+}
@@ -0,0 +1,32 @@
+// pattern_123_flipbook.cpp
+#include "../patterns.h"
+#include "../flipbook.h"
+
+// Flipbook - plays the stored animation (/uploadFlipbook) a frame at a time, each for its own
+// duration. Delta frames build on leds[], so this keeps its buffer (PATTERN_TRAIL) and
+// starts over from frame 0 when the LED count changes.
+void pattern_flipbook(CRGB* leds, int activeLeds, const FrameContext& ctx, FlipbookPlayer* book, FlipbookState& s) {
+  if (!book || !book->isOpen()) {
+    fill_solid(leds, activeLeds, CRGB::Black);
+    s.started = false;
+    return;
+  }
+  unsigned long now = ctx.now;
+  if (!s.started || s.activeLeds != activeLeds) {
+    fill_solid(leds, activeLeds, CRGB::Black);
+    s.started = book->restart() && book->nextFrame(leds, activeLeds);
+    s.activeLeds = activeLeds;
+    s.frameStart = now;
+    return;
+  }
+  // Frames shorter than the render period are decoded back to back (deltas cannot be
+  // skipped), up to a few per call; a longer backlog is dropped
+  for (int n = 0; n < 4 && now - s.frameStart >= book->duration(); n++) {
+    s.frameStart += book->duration();
+    if (!book->nextFrame(leds, activeLeds)) {
+      fill_solid(leds, activeLeds, CRGB::Black);
+      return;
+    }
+  }
+  if (now - s.frameStart >= book->duration()) s.frameStart = now;
+}
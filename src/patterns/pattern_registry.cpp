@@ -0,0 +1,340 @@
+// pattern_registry.cpp - Pattern table shared by firmware and simulator (see pattern_registry.h)
+#include "../pattern_registry.h"
+#include <new>
+
+namespace {
+
+// Adapters from the pattern function signatures to PatternDesc's fn/create/destroy.
+
+// Stateless (leds, activeLeds, ctx) patterns.
+template <void (*Fn)(CRGB*, int, const FrameContext&)>
+struct plain {
+  static void render(CRGB* leds, int activeLeds, const FrameContext& ctx, void*) {
+    Fn(leds, activeLeds, ctx);
+  }
+  static constexpr PatternCreateFn create = nullptr;
+  static constexpr PatternDestroyFn destroy = nullptr;
+};
+
+template <typename State>
+void* createState() {
+  return new (std::nothrow) State();
+}
+
+template <typename State>
+void destroyState(void* state) {
+  delete static_cast<State*>(state);
+}
+
+// (leds, activeLeds, ctx, State&) patterns.
+template <typename State, void (*Fn)(CRGB*, int, const FrameContext&, State&)>
+struct stateful {
+  static void render(CRGB* leds, int activeLeds, const FrameContext& ctx, void* state) {
+    Fn(leds, activeLeds, ctx, *static_cast<State*>(state));
+  }
+  static constexpr PatternCreateFn create = createState<State>;
+  static constexpr PatternDestroyFn destroy = destroyState<State>;
+};
+
+struct scrollingText {
+  static void render(CRGB* leds, int activeLeds, const FrameContext& ctx, void* state) {
+    const PatternParams& params = ctx.params;
+    pattern_scrolling_text(leds, activeLeds, ctx, params.text ? params.text : "", *params.scrollOffset,
+                           params.scrollSpeed, *static_cast<ScrollingTextState*>(state));
+  }
+  static constexpr PatternCreateFn create = createState<ScrollingTextState>;
+  static constexpr PatternDestroyFn destroy = destroyState<ScrollingTextState>;
+};
+
+struct customFrame {
+  static void render(CRGB* leds, int activeLeds, const FrameContext& ctx, void* state) {
+    pattern_custom(leds, activeLeds, ctx, ctx.params.custom, ctx.params.customScrollMs,
+                   *static_cast<CustomFrameState*>(state));
+  }
+  static constexpr PatternCreateFn create = createState<CustomFrameState>;
+  static constexpr PatternDestroyFn destroy = destroyState<CustomFrameState>;
+};
+
+struct flipbookPlayback {
+  static void render(CRGB* leds, int activeLeds, const FrameContext& ctx, void* state) {
+    pattern_flipbook(leds, activeLeds, ctx, ctx.params.flipbook, *static_cast<FlipbookState*>(state));
+  }
+  static constexpr PatternCreateFn create = createState<FlipbookState>;
+  static constexpr PatternDestroyFn destroy = destroyState<FlipbookState>;
+};
+
+// X(id, button style, flags, target fps (0 = scheduler default), UI name, adapter). The
+// adapter is last and variadic because stateful<State, fn> contains a comma.
+#ifndef SIMULATOR
+#define PATTERNS_1D(X) \
+  X(0  , rainbow, PATTERN_TRAIL,                  0 , "Rainbow Loop",        plain<pattern_1d_rainbow>) \
+  X(1  , red,     PATTERN_BASIC,                  10, "Red",                 plain<pattern_1d_red>) \
+  X(2  , green,   PATTERN_BASIC,                  10, "Green",               plain<pattern_1d_green>) \
+  X(3  , blue,    PATTERN_BASIC,                  10, "Blue",                plain<pattern_1d_blue>) \
+  X(4  , off,     PATTERN_BASIC,                  10, "Turn Off",            plain<pattern_1d_off>) \
+  X(5  , cool,    PATTERN_TRAIL,                  0 , "Confetti",            plain<pattern_1d_confetti>) \
+  X(6  , cool,    PATTERN_TRAIL,                  0 , "Sinelon (Cylon)",     plain<pattern_1d_sinelon>) \
+  X(7  , cool,    0,                              0 , "BPM Pulse",           plain<pattern_1d_bpm>) \
+  X(8  , cool,    PATTERN_TRAIL,                  0 , "Juggle",              plain<pattern_1d_juggle>) \
+  X(9  , fire,    0,                              0 , "Fire",                stateful<StripFireState, pattern_1d_fire>) \
+  X(10 , rainbow, PATTERN_TRAIL,                  0 , "Rainbow Glitter",     plain<pattern_1d_rainbow_glitter>) \
+  X(11 , special, 0,                              0 , "Candy Cane",          plain<pattern_1d_candy_cane>) \
+  X(12 , special, 0,                              0 , "Theater Chase",       plain<pattern_1d_theater_chase>) \
+  X(13 , green,   PATTERN_TRAIL,                  0 , "Matrix Rain",         plain<pattern_1d_matrix_rain>) \
+  X(14 , cool,    PATTERN_TRAIL,                  0 , "Twinkle",             plain<pattern_1d_twinkle>) \
+  X(15 , special, 0,                              0 , "Police Lights",       plain<pattern_1d_police_lights>) \
+  X(16 , cool,    0,                              0 , "Running Lights",      plain<pattern_1d_running_lights>) \
+  X(17 , cool,    0,                              0 , "Snow Sparkle",        plain<pattern_1d_snow_sparkle>) \
+  X(18 , special, 0,                              0 , "Color Wipe",          stateful<StripPositionState, pattern_1d_color_wipe>) \
+  X(19 , cool,    0,                              0 , "Color Pulse",         plain<pattern_1d_color_pulse>) \
+  X(20 , special, 0,                              0 , "Lightning",           stateful<StripTimestampState, pattern_1d_lightning>) \
+  X(21 , blue,    0,                              0 , "Ocean Waves",         plain<pattern_1d_ocean_waves>) \
+  X(22 , fire,    0,                              0 , "Lava Lamp",           plain<pattern_1d_lava_lamp>) \
+  X(23 , cool,    PATTERN_TRAIL,                  0 , "Meteor Rain",         plain<pattern_1d_meteor_rain>) \
+  X(24 , rainbow, 0,                              0 , "Pride",               plain<pattern_1d_pride>) \
+  X(25 , red,     0,                              0 , "Heartbeat",           plain<pattern_1d_heartbeat>) \
+  X(26 , cool,    PATTERN_TRAIL,                  0 , "Comet",               stateful<StripPositionState, pattern_1d_comet>) \
+  X(27 , special, 0,                              0 , "Gradient",            plain<pattern_1d_gradient>) \
+  X(28 , cool,    0,                              0 , "Random Colors",       stateful<StripTimerState, pattern_1d_random_colors>) \
+  X(29 , red,     PATTERN_TRAIL,                  0 , "Knight Rider",        plain<pattern_1d_knight_rider>) \
+  X(30 , cool,    0,                              0 , "Breathing",           stateful<StripTimerState, pattern_1d_breathing>) \
+  X(31 , special, 0,                              0 , "Strobe",              stateful<StripTimestampState, pattern_1d_strobe>) \
+  X(32 , special, PATTERN_TRAIL,                  0 , "Pac-Man",             plain<pattern_1d_pac_man>) \
+  X(33 , cool,    PATTERN_TRAIL,                  0 , "Bouncing Balls",      stateful<StripBouncingBallsState, pattern_1d_bouncing_balls>) \
+  X(34 , special, 0,                              0 , "USA Flag",            plain<pattern_1d_usa_flag>) \
+  X(35 , special, 0,                              0 , "Christmas",           plain<pattern_1d_christmas>) \
+  X(36 , rainbow, 0,                              0 , "Plasma",              plain<pattern_1d_plasma>) \
+  X(37 , cool,    PATTERN_TRAIL,                  0 , "Scanner",             plain<pattern_1d_scanner>) \
+  X(38 , cool,    0,                              0 , "Sparkle",             stateful<StripTimerState, pattern_1d_sparkle>) \
+  X(39 , rainbow, 0,                              0 , "Color Chase",         stateful<StripPositionState, pattern_1d_color_chase>) \
+  X(40 , rainbow, 0,                              0 , "Rainbow Wave",        plain<pattern_1d_rainbow_wave>) \
+  X(41 , fire,    0,                              0 , "Dragon Breath",       plain<pattern_1d_dragon_breath>) \
+  X(42 , special, 0,                              0 , "Aurora",              plain<pattern_1d_aurora>) \
+  X(43 , rainbow, PATTERN_TRAIL,                  0 , "Disco Ball",          stateful<StripTimerState, pattern_1d_disco_ball>) \
+  X(44 , blue,    PATTERN_TRAIL,                  0 , "Waterfall",           plain<pattern_1d_waterfall>) \
+  X(45 , special, 0,                              0 , "Neon Signs",          stateful<StripTimerState, pattern_1d_neon_signs>) \
+  X(46 , special, 0,                              0 , "Traffic Light",       stateful<StripTrafficLightState, pattern_1d_traffic_light>) \
+  X(47 , green,   0,                              0 , "Binary Code",         plain<pattern_1d_binary_code>) \
+  X(48 , rainbow, 0,                              0 , "Rave",                plain<pattern_1d_rave>) \
+  X(49 , fire,    0,                              0 , "Sunset",              plain<pattern_1d_sunset>) \
+  X(50 , fire,    0,                              0 , "Campfire",            plain<pattern_1d_campfire>) \
+  X(51 , special, PATTERN_TRAIL,                  0 , "Sparkler",            plain<pattern_1d_sparkler>) \
+  X(52 , blue,    PATTERN_TRAIL,                  0 , "Lighthouse",          plain<pattern_1d_lighthouse>) \
+  X(53 , special, 0,                              0 , "SOS Morse",           stateful<StripMorseState, pattern_1d_sos_morse_code>) \
+  X(54 , cool,    PATTERN_TRAIL,                  0 , "Meteor Shower",       plain<pattern_1d_meteor_shower>) \
+  X(55 , rainbow, 0,                              0 , "Rainbow Spiral",      plain<pattern_1d_rainbow_spiral>) \
+  X(56 , fire,    0,                              0 , "Lava Flow",           plain<pattern_1d_lava_flow>) \
+  X(57 , blue,    0,                              0 , "Ice Cave",            plain<pattern_1d_ice_cave>) \
+  X(58 , cool,    PATTERN_TRAIL,                  0 , "Fireflies",           plain<pattern_1d_fireflies>) \
+  X(59 , rainbow, 0,                              0 , "Circus",              plain<pattern_1d_circus>) \
+  X(60 , cool,    PATTERN_TRAIL,                  0 , "Warp Speed",          stateful<StripWarpSpeedState, pattern_1d_warp_speed>) \
+  X(61 , special, PATTERN_TRAIL,                  0 , "Radar Sweep",         plain<pattern_1d_radar_sweep>) \
+  X(62 , rainbow, 0,                              0 , "Equalizer Bars",      plain<pattern_1d_equalizer_bars>) \
+  X(63 , green,   0,                              0 , "Snake",               stateful<StripPositionState, pattern_1d_snake>) \
+  X(64 , cool,    0,                              0 , "Pulse Wave",          plain<pattern_1d_pulse_wave>) \
+  X(65 , rainbow, PATTERN_TRAIL,                  0 , "Color Explosion",     stateful<StripExplosionState, pattern_1d_color_explosion>) \
+  X(66 , green,   PATTERN_TRAIL,                  0 , "Digital Rain",        plain<pattern_1d_digital_rain>) \
+  X(67 , red,     0,                              0 , "Heartbeat Wave",      plain<pattern_1d_heartbeat_wave>) \
+  X(68 , special, PATTERN_TRAIL,                  0 , "Thunderstorm",        stateful<StripTimestampState, pattern_1d_thunderstorm>) \
+  X(69 , rainbow, 0,                              0 , "Rainbow Fade",        plain<pattern_1d_rainbow_fade>) \
+  X(70 , special, 0,                              0 , "Disco Strobe",        stateful<StripTimestampState, pattern_1d_disco_strobe>) \
+  X(71 , special, 0,                              0 , "Biohazard",           plain<pattern_1d_biohazard>) \
+  X(72 , blue,    0,                              0 , "Ocean Depth",         plain<pattern_1d_ocean_depth>) \
+  X(73 , cool,    PATTERN_TRAIL,                  0 , "Pixel Sort",          stateful<StripPixelSortState, pattern_1d_pixel_sort>) \
+  X(74 , special, PATTERN_TRAIL,                  0 , "Glitch",              stateful<StripTimestampState, pattern_1d_glitch>) \
+  X(75 , blue,    PATTERN_TRAIL,                  0 , "Tron",                stateful<StripPositionState, pattern_1d_tron>) \
+  X(76 , fire,    0,                              0 , "Ember",               plain<pattern_1d_ember>) \
+  X(77 , green,   0,                              0 , "Aurora Borealis",     plain<pattern_1d_aurora_borealis>) \
+  X(78 , cool,    0,                              0 , "Neon Pulse",          plain<pattern_1d_neon_pulse>) \
+  X(79 , rainbow, 0,                              0 , "Rainbow Ripple",      stateful<StripRippleState, pattern_1d_rainbow_ripple>) \
+  X(80 , rainbow, 0,                              0 , "Kaleidoscope",        plain<pattern_1d_kaleidoscope>) \
+  X(81 , special, 0,                              0 , "DNA Helix",           plain<pattern_1d_dna_helix>) \
+  X(82 , fire,    PATTERN_TRAIL,                  0 , "Fireworks",           stateful<StripFireworksState, pattern_1d_fireworks>) \
+  X(83 , rainbow, 0,                              0 , "VU Meter",            plain<pattern_1d_vu_meter>) \
+  X(84 , cool,    0,                              0 , "Spinning Wheel",      plain<pattern_1d_spinning_wheel>) \
+  X(85 , rainbow, 0,                              0 , "Color Bands",         plain<pattern_1d_color_bands>) \
+  X(86 , special, PATTERN_TRAIL,                  0 , "Starfield",           plain<pattern_1d_starfield>) \
+  X(87 , green,   0,                              0 , "Binary Counter",      stateful<StripCounterState, pattern_1d_binary_counter>) \
+  X(88 , rainbow, 0,                              0 , "Breathing Rainbow",   plain<pattern_1d_breathing_rainbow>) \
+  X(89 , cool,    0,                              0 , "Wave Interference",   plain<pattern_1d_wave_interference>) \
+  X(90 , cool,    PATTERN_TRAIL,                  0 , "Bouncing Ball",       stateful<StripBouncingBallState, pattern_1d_bouncing_ball>) \
+  X(91 , fire,    0,                              0 , "Color Temperature",   stateful<StripHotSpotState, pattern_1d_color_temperature>) \
+  X(92 , special, 0,                              0 , "Police Siren",        stateful<StripSirenState, pattern_1d_police_siren>) \
+  X(93 , special, 0,                              0 , "Candy Stripes",       plain<pattern_1d_candy_stripes>) \
+  X(94 , cool,    PATTERN_TRAIL,                  0 , "Pixel Rain",          plain<pattern_1d_pixel_rain>) \
+  X(95 , special, 0,                              0 , "Energy Field",        plain<pattern_1d_energy_field>) \
+  X(96 , cool,    PATTERN_TRAIL,                  0 , "Orbit",               plain<pattern_1d_orbit>) \
+  X(97 , cool,    0,                              0 , "Pulse Ring",          stateful<StripPositionState, pattern_1d_pulse_ring>) \
+  X(98 , rainbow, PATTERN_TRAIL,                  0 , "Random Walk",         stateful<StripWalkerState, pattern_1d_random_walk>) \
+  X(99 , fire,    PATTERN_TRAIL,                  0 , "Supernova",           stateful<StripSupernovaState, pattern_1d_supernova>)
+#else
+#define PATTERNS_1D(X)
+#endif
+
+#define PATTERNS_2D(X) \
+  X(100, rainbow, PATTERN_2D,                     0 , "Horizontal Bars",     plain<pattern_horizontal_bars>) \
+  X(101, cool,    PATTERN_2D,                     0 , "Vertical Ripple",     plain<pattern_vertical_ripple>) \
+  X(102, fire,    PATTERN_2D,                     0 , "2D Fire Rising",      stateful<FireRisingState, pattern_fire_rising>) \
+  X(103, blue,    PATTERN_2D | PATTERN_TRAIL,     0 , "Rain Drops",          plain<pattern_rain_drops>) \
+  X(104, rainbow, PATTERN_2D,                     0 , "Vertical Equalizer",  plain<pattern_vertical_equalizer>) \
+  X(105, cool,    PATTERN_2D | PATTERN_TRAIL,     0 , "Scanning Lines",      stateful<ScanningLinesState, pattern_scanning_lines>) \
+  X(106, special, PATTERN_2D,                     0 , "Checkerboard",        plain<pattern_checkerboard>) \
+  X(107, rainbow, PATTERN_2D,                     0 , "Diagonal Sweep",      plain<pattern_diagonal_sweep>) \
+  X(108, cool,    PATTERN_2D,                     0 , "Vertical Wave",       plain<pattern_vertical_wave>) \
+  X(109, special, PATTERN_2D,                     0 , "Plasma 2D",           plain<pattern_plasma_2d>) \
+  X(110, green,   PATTERN_2D | PATTERN_TRAIL,     0 , "Matrix Rain 2D",      stateful<MatrixRainState, pattern_matrix_rain>) \
+  X(111, cool,    PATTERN_2D,                     0 , "Game of Life",        stateful<GameOfLifeState, pattern_game_of_life>) \
+  X(112, blue,    PATTERN_2D,                     0 , "Wave Pool",           plain<pattern_wave_pool>) \
+  X(113, green,   PATTERN_2D,                     0 , "Aurora 2D",           plain<pattern_aurora_2d>) \
+  X(114, fire,    PATTERN_2D,                     0 , "Lava Lamp 2D",        stateful<LavaLampState, pattern_lava_lamp>) \
+  X(115, special, PATTERN_2D,                     0 , "2D Ripple",           stateful<Ripple2DState, pattern_ripple_2d>) \
+  X(116, cool,    PATTERN_2D | PATTERN_TRAIL,     0 , "Starfield Parallax",  stateful<StarfieldState, pattern_starfield>) \
+  X(117, fire,    PATTERN_2D,                     0 , "Side Fire",           stateful<SideFireState, pattern_side_fire>) \
+  X(118, rainbow, PATTERN_2D,                     0 , "Scrolling Rainbow",   stateful<ScrollingRainbowState, pattern_scrolling_rainbow>) \
+  X(119, special, PATTERN_2D | PATTERN_TRAIL,     0 , "Particle Fountain",   stateful<ParticleFountainState, pattern_particle_fountain>) \
+  X(120, special, PATTERN_2D | PATTERN_HIDDEN,    0 , "Scrolling Text",      scrollingText) \
+  X(121, cool,    PATTERN_2D,                     0 , "Test Card",           stateful<TestCardState, pattern_test_card>) \
+  X(122, special, PATTERN_HIDDEN,                 10, "Custom Pattern",      customFrame) \
+  X(123, special, PATTERN_HIDDEN | PATTERN_TRAIL, 0 , "Flipbook",            flipbookPlayback)
+
+#ifdef PATTERN_SUBSET
+constexpr int kPatternSubset[] = { PATTERN_SUBSET };
+constexpr bool patternEnabled(int id) {
+  for (int s : kPatternSubset) {
+    if (s == id) return true;
+  }
+  return false;
+}
+#else
+constexpr bool patternEnabled(int) { return true; }
+#endif
+
+const char kStyle_rainbow[] PROGMEM = "rainbow";
+const char kStyle_red[] PROGMEM = "red";
+const char kStyle_green[] PROGMEM = "green";
+const char kStyle_blue[] PROGMEM = "blue";
+const char kStyle_cool[] PROGMEM = "cool";
+const char kStyle_fire[] PROGMEM = "fire";
+const char kStyle_special[] PROGMEM = "special";
+const char kStyle_off[] PROGMEM = "off";
+
+#define PATTERN_NAME(id, style, flags, fps, name, ...) const char kName##id[] PROGMEM = name;
+PATTERNS_1D(PATTERN_NAME)
+PATTERNS_2D(PATTERN_NAME)
+
+#define PATTERN_DESC(id, style, flags, fps, name, ...) \
+  { __VA_ARGS__::render, __VA_ARGS__::create, __VA_ARGS__::destroy, kName##id, kStyle_##style, id, flags, fps },
+constexpr PatternDesc kAllPatterns[] = {
+  PATTERNS_1D(PATTERN_DESC)
+  PATTERNS_2D(PATTERN_DESC)
+};
+
+constexpr int countEnabled() {
+  int n = 0;
+  for (const PatternDesc& d : kAllPatterns) {
+    if (patternEnabled(d.id)) n++;
+  }
+  return n;
+}
+
+constexpr int kPatternCount = countEnabled();
+constexpr uint8_t kNoSlot = 0xFF;
+
+// Compiled-in descriptors plus an id -> table position index, both built at compile
+// time. Only enabled entries are emitted, so disabled patterns cost no flash.
+struct PatternTable {
+  PatternDesc entries[kPatternCount > 0 ? kPatternCount : 1];
+  uint8_t slot[256];
+};
+
+constexpr PatternTable buildTable() {
+  PatternTable t{};
+  for (int i = 0; i < 256; i++) t.slot[i] = kNoSlot;
+  int n = 0;
+  for (const PatternDesc& d : kAllPatterns) {
+    if (!patternEnabled(d.id)) continue;
+    t.slot[d.id] = n;
+    t.entries[n++] = d;
+  }
+  return t;
+}
+
+constexpr PatternTable kTable PROGMEM = buildTable();
+
+} // namespace
+
+int patternCount() {
+  return kPatternCount;
+}
+
+bool patternAt(int index, PatternDesc& out) {
+  if (index < 0 || index >= kPatternCount) return false;
+  memcpy_P(&out, &kTable.entries[index], sizeof(PatternDesc));
+  return true;
+}
+
+bool findPattern(int id, PatternDesc& out) {
+  if (id < 0 || id > 255) return false;
+  uint8_t slot = pgm_read_byte(&kTable.slot[id]);
+  if (slot == kNoSlot) return false;
+  return patternAt(slot, out);
+}
+
+bool PatternInstance::activate(int id) {
+  if (ready_ && id == id_) return true;
+  deactivate();
+  if (!findPattern(id, desc_)) return false;
+  if (desc_.create) {
+    state_ = desc_.create();
+    if (!state_) return false;  // retried on the next activate()
+  }
+  id_ = id;
+  ready_ = true;
+  rng_ = random16();
+  frames_ = 0;
+  carryMs_ = 0;
+  return true;
+}
+
+void PatternInstance::deactivate() {
+  if (state_) desc_.destroy(state_);
+  state_ = nullptr;
+  id_ = -1;
+  ready_ = false;
+}
+
+void PatternInstance::render(CRGB* leds, int activeLeds, uint8_t& hue, const PatternParams& params) {
+  if (!ready_) {
+    fill_solid(leds, MAX_LEDS, CRGB::Black);
+    return;
+  }
+  // Trail patterns fade what is already in the buffer; everything else starts from black
+  // so changing sizes/patterns never leaves stale pixels behind.
+  if (!(desc_.flags & PATTERN_TRAIL)) {
+    fill_solid(leds, MAX_LEDS, CRGB::Black);
+  }
+  unsigned long now = millis();
+  uint32_t dt = frames_ ? (uint32_t)(now - lastMs_) : 0;
+  uint8_t steps = 1;
+  if (frames_) {
+    // Nearest whole tick, so a frame a millisecond early or late still moves one
+    const int32_t tick = FrameContext::kFrameTickMs;
+    int32_t elapsed = (int32_t)(dt < 1000 ? dt : 1000) + carryMs_;
+    int32_t ticks = (elapsed + tick / 2) / tick;
+    if (ticks > FrameContext::kMaxFrameSteps) {
+      ticks = FrameContext::kMaxFrameSteps;
+      carryMs_ = 0;
+    } else {
+      carryMs_ = elapsed - ticks * tick;
+    }
+    steps = (uint8_t)ticks;
+  }
+  lastMs_ = now;
+  FrameContext ctx = { (uint32_t)now, dt, frames_++, steps, hue, params.palette, params };
+
+  uint16_t outer = random16_get_seed();
+  random16_set_seed(rng_);
+  desc_.fn(leds, activeLeds, ctx, state_);
+  rng_ = random16_get_seed();
+  random16_set_seed(outer);
+}
@@ -0,0 +1,1096 @@
+// patterns_1d.cpp - 1D strip patterns (0-99), moved out of the renderPatternFrame switch.
+// Firmware only: these lean on FastLED helpers (fill_rainbow, ColorFromPalette,
+// rgb2hsv_approximate, ...) that the simulator shims in platform.h do not provide.
+#ifndef SIMULATOR
+
+#include "../patterns.h"
+
+// Rainbow
+void pattern_1d_rainbow(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  fill_rainbow(leds, activeLeds, ctx.hue, 7);
+  ctx.hue += ctx.steps;
+}
+
+// Red
+void pattern_1d_red(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  fill_solid(leds, activeLeds, CRGB::Red);
+}
+
+// Green
+void pattern_1d_green(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  fill_solid(leds, activeLeds, CRGB::Green);
+}
+
+// Blue
+void pattern_1d_blue(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  fill_solid(leds, activeLeds, CRGB::Blue);
+}
+
+// Off
+void pattern_1d_off(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  fill_solid(leds, MAX_LEDS, CRGB::Black);
+}
+
+// Confetti
+void pattern_1d_confetti(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  // One fade and one spark per step
+  for (uint8_t n = 0; n < ctx.steps; n++) {
+    fadeToBlackBy(leds, activeLeds, 10);
+    int pos = random16(activeLeds);
+    leds[pos] += CHSV(ctx.hue + random8(64), 200, 255);
+    ctx.hue++;
+  }
+}
+
+// Sinelon
+void pattern_1d_sinelon(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  fadeToBlackBySteps(leds, activeLeds, 20, ctx.steps);
+  int pos2 = beatsin16(13, 0, activeLeds-1);
+  leds[pos2] += paletteColor(ctx.palette, ctx.hue, 192);
+  ctx.hue += ctx.steps;
+}
+
+// BPM
+void pattern_1d_bpm(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  uint8_t beat = beatsin8(62, 64, 255);
+  for(int i = 0; i < activeLeds; i++) {
+    leds[i] = ColorFromPalette(PartyColors_p, ctx.hue+(i*2), beat-ctx.hue+(i*10));
+  }
+  ctx.hue += ctx.steps;
+}
+
+// Juggle
+void pattern_1d_juggle(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  fadeToBlackBySteps(leds, activeLeds, 20, ctx.steps);
+  byte dothue = 0;
+  for(int i = 0; i < 8; i++) {
+    leds[beatsin16(i+7, 0, activeLeds-1)] |= CHSV(dothue, 200, 255);
+    dothue += 32;
+  }
+}
+
+// Fire
+void pattern_1d_fire(CRGB* leds, int activeLeds, const FrameContext& ctx, StripFireState& s) {
+  uint8_t* heat = s.heat;
+  for (uint8_t n = 0; n < ctx.steps; n++) {
+    for( int i = 0; i < activeLeds; i++) heat[i] = qsub8( heat[i],  random8(0, ((55 * 10) / activeLeds) + 2));
+    for( int k= activeLeds - 1; k >= 2; k--) heat[k] = (heat[k - 1] + heat[k - 2] + heat[k - 2] ) / 3;
+    if( random8() < 120 ) { int y = random8(7); heat[y] = qadd8( heat[y], random8(160,255) ); }
+  }
+  for( int j = 0; j < activeLeds; j++) leds[j] = HeatColor( heat[j]);
+}
+
+// Rainbow Glitter
+void pattern_1d_rainbow_glitter(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  fill_rainbow(leds, activeLeds, ctx.hue, 7);
+  ctx.hue += ctx.steps;
+  if( random8() < 80) leds[ random16(activeLeds) ] += CRGB::White;
+}
+
+// Candy Cane
+void pattern_1d_candy_cane(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  for (int i = 0; i < activeLeds; i++) {
+    if (((i + ctx.hue/4) % 4) < 2) leds[i] = CRGB::Red;
+    else leds[i] = CRGB::White;
+  }
+  ctx.hue += ctx.steps;
+}
+
+// Theater Chase
+void pattern_1d_theater_chase(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  for (int i = 0; i < activeLeds; i++) {
+    if (((i + ctx.hue/10) % 3) == 0) leds[i] = CRGB::Red;
+    else leds[i] = CRGB::Black;
+  }
+  ctx.hue += ctx.steps;
+}
+
+// Matrix Rain
+void pattern_1d_matrix_rain(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  for (uint8_t n = 0; n < ctx.steps; n++) {
+    fadeToBlackBy(leds, activeLeds, 20);
+    if (random8() < 25) leds[random16(activeLeds)] = CRGB::Green;
+  }
+}
+
+// Twinkle
+void pattern_1d_twinkle(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  for (uint8_t n = 0; n < ctx.steps; n++) {
+    fadeToBlackBy(leds, activeLeds, 10);
+    if (random8() < 80) leds[random16(activeLeds)] = CRGB::White;
+  }
+}
+
+// Police Lights
+void pattern_1d_police_lights(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  for (int i = 0; i < activeLeds; i++) {
+    if (((i + ctx.hue/16) % 8) < 4) leds[i] = CRGB::Blue;
+    else leds[i] = CRGB::Red;
+  }
+  ctx.hue += 4 * ctx.steps;
+}
+
+// Running Lights
+void pattern_1d_running_lights(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  for(int i=0; i<activeLeds; i++) {
+    leds[i] = paletteColor(ctx.palette, ctx.hue, (sin8(i*10 + ctx.hue*4) + 128)/2);
+  }
+  ctx.hue += ctx.steps;
+}
+
+// Snow Sparkle
+void pattern_1d_snow_sparkle(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  fill_solid(leds, activeLeds, CRGB(16, 16, 16)); // Grey background
+  if (random8() < 20) leds[random16(activeLeds)] = CRGB::White;
+}
+
+// Color Wipe
+void pattern_1d_color_wipe(CRGB* leds, int activeLeds, const FrameContext& ctx, StripPositionState& s) {
+  fill_solid(leds, s.pos, ctx.palette[ctx.hue]);
+  s.pos += ctx.steps;
+  if (s.pos >= activeLeds) { s.pos = 0; ctx.hue += 32; }
+}
+
+// Color Pulse
+void pattern_1d_color_pulse(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  fill_solid(leds, activeLeds, paletteColor(ctx.palette, ctx.hue, beatsin8(30, 50, 255)));
+  ctx.hue += ctx.steps;
+}
+
+// Lightning
+void pattern_1d_lightning(CRGB* leds, int activeLeds, const FrameContext& ctx, StripTimestampState& s) {
+  if (ctx.now - s.last > random(100, 1000)) {
+    fill_solid(leds, activeLeds, CRGB::White);
+    s.last = ctx.now;
+  } else {
+    fill_solid(leds, activeLeds, CRGB::Black);
+  }
+}
+
+// Ocean Waves
+void pattern_1d_ocean_waves(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  for(int i=0; i<activeLeds; i++) {
+    uint8_t wave1 = sin8((i * 10) + (ctx.hue * 2));
+    uint8_t wave2 = sin8((i * 15) + (ctx.hue * 3));
+    leds[i] = paletteColor(ctx.palette, 160, (wave1 + wave2) / 2);
+  }
+  ctx.hue += ctx.steps;
+}
+
+// Lava Lamp
+void pattern_1d_lava_lamp(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  for(int i=0; i<activeLeds; i++) {
+    uint8_t blob1 = sin8((i * 5) + (ctx.hue));
+    uint8_t blob2 = sin8((i * 7) + (ctx.hue * 2));
+    leds[i] = paletteColor(ctx.palette, ctx.hue/4, (blob1 + blob2) / 2);
+  }
+  ctx.hue += ctx.steps;
+}
+
+// Meteor Rain
+void pattern_1d_meteor_rain(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  fadeToBlackBySteps(leds, activeLeds, 64, ctx.steps);
+  int pos = beatsin16(20, 0, activeLeds-1);
+  leds[pos] = CHSV(ctx.hue, 200, 255);
+  ctx.hue += ctx.steps;
+}
+
+// Pride
+void pattern_1d_pride(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  fill_rainbow(leds, activeLeds, ctx.hue, 255/activeLeds);
+  ctx.hue += ctx.steps;
+}
+
+// Heartbeat
+void pattern_1d_heartbeat(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  uint8_t beat1 = beatsin8(60, 0, 255);
+  uint8_t beat2 = beatsin8(120, 0, 255);
+  uint8_t combined = qadd8(beat1, beat2);
+  fill_solid(leds, activeLeds, CRGB(combined, 0, 0));
+}
+
+// Comet
+void pattern_1d_comet(CRGB* leds, int activeLeds, const FrameContext& ctx, StripPositionState& s) {
+  // Every step is drawn, so the trail looks as it would at full frame rate
+  int& cometPos = s.pos;
+  for (uint8_t n = 0; n < ctx.steps; n++) {
+    fadeToBlackBy(leds, activeLeds, 128);
+    leds[cometPos] = ctx.palette[ctx.hue];
+    if (cometPos > 0) leds[cometPos-1] = paletteColor(ctx.palette, ctx.hue, 128);
+    if (cometPos > 1) leds[cometPos-2] = paletteColor(ctx.palette, ctx.hue, 64);
+    cometPos++;
+    if (cometPos >= activeLeds) { cometPos = 0; ctx.hue += 32; }
+  }
+}
+
+// Gradient
+void pattern_1d_gradient(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  fill_gradient_RGB(leds, 0, ctx.palette[ctx.hue], activeLeds-1, ctx.palette[(uint8_t)(ctx.hue+128)]);
+  ctx.hue += ctx.steps;
+}
+
+// Random Colors
+void pattern_1d_random_colors(CRGB* leds, int activeLeds, const FrameContext& ctx, StripTimerState& s) {
+  if (s.timer.every(ctx.now, 100)) {
+    for(int i=0; i<activeLeds; i++) {
+      leds[i] = ctx.palette[random8()];
+    }
+  }
+}
+
+// Knight Rider
+void pattern_1d_knight_rider(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  fadeToBlackBySteps(leds, activeLeds, 64, ctx.steps);
+  int pos = beatsin16(13, 0, activeLeds-1);
+  leds[pos] = CRGB::Red;
+  if (pos > 0) leds[pos-1] = CRGB(64, 0, 0);
+  if (pos < activeLeds-1) leds[pos+1] = CRGB(64, 0, 0);
+}
+
+// Breathing
+void pattern_1d_breathing(CRGB* leds, int activeLeds, const FrameContext& ctx, StripTimerState& s) {
+  uint8_t brightness = beatsin8(20, 50, 255);
+  fill_solid(leds, activeLeds, paletteColor(ctx.palette, ctx.hue, brightness));
+  if (s.timer.every(ctx.now, 5000)) { ctx.hue += 32; }
+}
+
+// Strobe
+void pattern_1d_strobe(CRGB* leds, int activeLeds, const FrameContext& ctx, StripTimestampState& s) {
+  if (ctx.now - s.last > 100) {
+    fill_solid(leds, activeLeds, random8() % 2 ? CRGB::White : CRGB::Black);
+    s.last = ctx.now;
+  }
+}
+
+// Pac-Man
+void pattern_1d_pac_man(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  fadeToBlackBySteps(leds, activeLeds, 128, ctx.steps);
+  int pacPos = beatsin16(10, 0, activeLeds-1);
+  leds[pacPos] = CRGB::Yellow;
+  for(int i=0; i<5; i++) {
+    int ghostPos = beatsin16(8+i, 0, activeLeds-1, 0, i*10000);
+    if (ghostPos < activeLeds) leds[ghostPos] = CRGB::White;
+  }
+}
+
+// Bouncing Balls
+void pattern_1d_bouncing_balls(CRGB* leds, int activeLeds, const FrameContext& ctx, StripBouncingBallsState& s) {
+  float* positions = s.positions;
+  float* velocities = s.velocities;
+  if (!s.started) {
+    positions[0] = 0;
+    positions[1] = activeLeds/3;
+    positions[2] = activeLeds*2/3;
+    s.started = true;
+  }
+  fill_solid(leds, activeLeds, CRGB::Black);
+  for(int i=0; i<3; i++) {
+    for (uint8_t n = 0; n < ctx.steps; n++) {
+      velocities[i] += 0.5; // gravity
+      positions[i] += velocities[i];
+      if (positions[i] >= activeLeds-1) {
+        positions[i] = activeLeds-1;
+        velocities[i] *= -0.9; // bounce with damping
+      }
+    }
+    leds[(int)positions[i]] = ctx.palette[(uint8_t)(i*85)];
+  }
+}
+
+// USA Flag
+void pattern_1d_usa_flag(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  for(int i=0; i<activeLeds; i++) {
+    if (i < activeLeds/3) leds[i] = CRGB::Red;
+    else if (i < activeLeds*2/3) leds[i] = CRGB::White;
+    else leds[i] = CRGB::Blue;
+  }
+}
+
+// Christmas
+void pattern_1d_christmas(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  for(int i=0; i<activeLeds; i++) {
+    if (((i + ctx.hue/4) % 2) == 0) leds[i] = CRGB::Red;
+    else leds[i] = CRGB::Green;
+  }
+  ctx.hue += ctx.steps;
+}
+
+// Plasma
+void pattern_1d_plasma(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  for(int i=0; i<activeLeds; i++) {
+    uint8_t wave1 = sin8((i * 8) + (ctx.hue));
+    uint8_t wave2 = sin8((i * 12) + (ctx.hue * 2));
+    uint8_t wave3 = sin8((i * 16) + (ctx.hue * 3));
+    leds[i] = ctx.palette[(wave1 + wave2 + wave3) / 3];
+  }
+  ctx.hue += ctx.steps;
+}
+
+// Scanner
+void pattern_1d_scanner(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  fadeToBlackBySteps(leds, activeLeds, 64, ctx.steps);
+  for(int i=0; i<4; i++) {
+    int pos = beatsin16(13+i*2, 0, activeLeds-1, 0, i*8192);
+    leds[pos] = ctx.palette[(uint8_t)(ctx.hue + i*64)];
+  }
+  ctx.hue += ctx.steps;
+}
+
+// Sparkle
+void pattern_1d_sparkle(CRGB* leds, int activeLeds, const FrameContext& ctx, StripTimerState& s) {
+  fill_solid(leds, activeLeds, paletteColor(ctx.palette, ctx.hue, 32));
+  if (random8() < 40) leds[random16(activeLeds)] = CRGB::White;
+  if (s.timer.every(ctx.now, 3000)) { ctx.hue += 32; }
+}
+
+// Color Chase
+void pattern_1d_color_chase(CRGB* leds, int activeLeds, const FrameContext& ctx, StripPositionState& s) {
+  int& chasePos = s.pos;
+  for(int i=0; i<activeLeds; i++) {
+    int diff = abs(i - chasePos);
+    if (diff < 5) leds[i] = ctx.palette[ctx.hue];
+    else leds[i] = CRGB::Black;
+  }
+  chasePos += ctx.steps;
+  if (chasePos >= activeLeds) { chasePos = 0; ctx.hue += 32; }
+}
+
+// Rainbow Wave
+void pattern_1d_rainbow_wave(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  for(int i=0; i<activeLeds; i++) {
+    leds[i] = paletteColor(ctx.palette, ctx.hue + (i * 256 / activeLeds), beatsin8(10, 128, 255, 0, i*4));
+  }
+  ctx.hue += ctx.steps;
+}
+
+// Dragon Breath
+void pattern_1d_dragon_breath(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  for(int i=0; i<activeLeds; i++) {
+    uint8_t flicker = random8(20);
+    leds[i] = paletteColor(ctx.palette, 0, qadd8(220 - flicker, beatsin8(40, 0, 50)));
+  }
+}
+
+// Aurora (Northern Lights)
+void pattern_1d_aurora(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  for(int i=0; i<activeLeds; i++) {
+    uint8_t wave = sin8((i * 10) + (ctx.hue * 2));
+    uint8_t colorIndex = 96 + (wave / 4); // Green-ish to purple
+    leds[i] = CHSV(colorIndex, 200, wave);
+  }
+  ctx.hue += ctx.steps;
+}
+
+// Disco Ball
+void pattern_1d_disco_ball(CRGB* leds, int activeLeds, const FrameContext& ctx, StripTimerState& s) {
+  for (uint16_t n = s.timer.every(ctx.now, 50); n > 0; n--) {
+    int spot = random16(activeLeds);
+    leds[spot] = ctx.palette[random8()];
+  }
+  fadeToBlackBySteps(leds, activeLeds, 30, ctx.steps);
+}
+
+// Waterfall
+void pattern_1d_waterfall(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  for (uint8_t n = 0; n < ctx.steps; n++) {
+    for(int i=activeLeds-1; i>0; i--) {
+      leds[i] = leds[i-1];
+    }
+    leds[0] = paletteColor(ctx.palette, 160, beatsin8(20, 100, 255));
+  }
+}
+
+// Neon Signs
+void pattern_1d_neon_signs(CRGB* leds, int activeLeds, const FrameContext& ctx, StripTimerState& s) {
+  for(int i=0; i<activeLeds; i++) {
+    if ((i % 10) < 5) leds[i] = ctx.palette[ctx.hue];
+    else leds[i] = ctx.palette[(uint8_t)(ctx.hue + 128)];
+  }
+  if (s.timer.every(ctx.now, 2000)) { ctx.hue += 32; }
+}
+
+// Traffic Light
+void pattern_1d_traffic_light(CRGB* leds, int activeLeds, const FrameContext& ctx, StripTrafficLightState& s) {
+  if (ctx.now - s.lastChange > 2000) {
+    s.phase = (s.phase + 1) % 3;
+    s.lastChange = ctx.now;
+  }
+  CRGB color = (s.phase == 0) ? CRGB::Green : (s.phase == 1) ? CRGB::Yellow : CRGB::Red;
+  fill_solid(leds, activeLeds, color);
+}
+
+// Binary Code
+void pattern_1d_binary_code(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  for(int i=0; i<activeLeds; i++) {
+    leds[i] = ((random8() % 2) && (i % 2 == (ctx.hue/10) % 2)) ? CRGB::Green : CRGB::Black;
+  }
+  ctx.hue += ctx.steps;
+}
+
+// Rave
+void pattern_1d_rave(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  for(int i=0; i<activeLeds; i++) {
+    leds[i] = paletteColor(ctx.palette, beatsin8(30 + i, 0, 255), beatsin8(15, 100, 255));
+  }
+}
+
+// Sunset
+void pattern_1d_sunset(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  for(int i=0; i<activeLeds; i++) {
+    float pos = (float)i / activeLeds;
+    if (pos < 0.5) {
+      leds[i] = CRGB(255, 60 + pos*40, pos*200);
+    } else {
+      leds[i] = CRGB(255 - (pos-0.5)*500, 100 - (pos-0.5)*180, 100 - (pos-0.5)*180);
+    }
+  }
+}
+
+// Campfire
+void pattern_1d_campfire(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  for(int i=0; i<activeLeds; i++) {
+    uint8_t flicker = random8(60);
+    leds[i] = CRGB(200 - flicker, 100 - (flicker/2), 0);
+  }
+}
+
+// Sparkler
+void pattern_1d_sparkler(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  for (uint8_t n = 0; n < ctx.steps; n++) {
+    fadeToBlackBy(leds, activeLeds, 50);
+    for(int i=0; i<10; i++) {
+      if (random8() < 50) {
+        leds[random16(activeLeds)] = CRGB::White;
+      }
+    }
+  }
+}
+
+// Lighthouse
+void pattern_1d_lighthouse(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  fadeToBlackBySteps(leds, activeLeds, 64, ctx.steps);
+  int beam = beatsin16(8, 0, activeLeds-1);
+  for(int i=beam-2; i<=beam+2; i++) {
+    if (i >= 0 && i < activeLeds) {
+      leds[i] = CRGB::White;
+    }
+  }
+}
+
+// SOS Morse Code
+void pattern_1d_sos_morse_code(CRGB* leds, int activeLeds, const FrameContext& ctx, StripMorseState& s) {
+  static const int pattern[] = {1,0,1,0,1,0,0,3,0,3,0,3,0,0,1,0,1,0,1,0,0,0}; // S=..., O=---, S=...
+  int dotTime = 200;
+
+  if (ctx.now - s.lastBlink > dotTime * pattern[s.patternIdx]) {
+    s.patternIdx = (s.patternIdx + 1) % 22;
+    s.lastBlink = ctx.now;
+  }
+  fill_solid(leds, activeLeds, (pattern[s.patternIdx] > 0) ? CRGB::Red : CRGB::Black);
+}
+
+// Meteor Shower
+void pattern_1d_meteor_shower(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  fadeToBlackBySteps(leds, activeLeds, 30, ctx.steps);
+  for(int i=0; i<5; i++) {
+    int meteor = beatsin16(20 + i*4, 0, activeLeds-1, 0, i*13000);
+    if (meteor < activeLeds) leds[meteor] = CHSV(ctx.hue + i*50, 200, 255);
+  }
+  ctx.hue += ctx.steps;
+}
+
+// Rainbow Spiral
+void pattern_1d_rainbow_spiral(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  for(int i=0; i<activeLeds; i++) {
+    leds[i] = ctx.palette[(ctx.hue + (i * 10)) % 256];
+  }
+  ctx.hue += 2 * ctx.steps;
+}
+
+// Lava Flow
+void pattern_1d_lava_flow(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  for(int i=0; i<activeLeds; i++) {
+    uint8_t heat = qsub8(inoise8(i*20, ctx.hue), abs8(i - (activeLeds/2)) * 2);
+    leds[i] = HeatColor(heat);
+  }
+  ctx.hue += ctx.steps;
+}
+
+// Ice Cave
+void pattern_1d_ice_cave(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  for(int i=0; i<activeLeds; i++) {
+    uint8_t brightness = inoise8(i*30, ctx.hue);
+    leds[i] = paletteColor(ctx.palette, 160, brightness);
+  }
+  ctx.hue += ctx.steps;
+}
+
+// Fireflies
+void pattern_1d_fireflies(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  for (uint8_t n = 0; n < ctx.steps; n++) {
+    fadeToBlackBy(leds, activeLeds, 10);
+    if (random8() < 20) {
+      int pos = random16(activeLeds);
+      leds[pos] = CHSV(32, 200, 255);
+    }
+  }
+}
+
+// Circus
+void pattern_1d_circus(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  for(int i=0; i<activeLeds; i++) {
+    if (((i + ctx.hue/8) % 5) == 0) leds[i] = ctx.palette[random8()];
+    else leds[i] = CRGB::White;
+  }
+  ctx.hue += ctx.steps;
+}
+
+// Warp Speed
+void pattern_1d_warp_speed(CRGB* leds, int activeLeds, const FrameContext& ctx, StripWarpSpeedState& s) {
+  int* warpPos = s.warpPos;
+  for (uint8_t n = 0; n < ctx.steps; n++) {
+    for(int i=0; i<10; i++) {
+      warpPos[i] += (i+1)*2;
+      if (warpPos[i] >= activeLeds) warpPos[i] = 0;
+      leds[warpPos[i]] = ctx.palette[(uint8_t)(160 + i*10)];
+    }
+    fadeToBlackBy(leds, activeLeds, 100);
+  }
+}
+
+// Radar Sweep
+void pattern_1d_radar_sweep(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  fadeToBlackBySteps(leds, activeLeds, 20, ctx.steps);
+  int sweepPos = beatsin16(10, 0, activeLeds-1);
+  for(int i=-5; i<=5; i++) {
+    int pos = sweepPos + i;
+    if (pos >= 0 && pos < activeLeds) {
+      leds[pos] = paletteColor(ctx.palette, 96, 255 - abs(i)*40);
+    }
+  }
+}
+
+// Equalizer Bars
+void pattern_1d_equalizer_bars(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  for(int i=0; i<activeLeds; i++) {
+    int bar = i / (activeLeds/8);
+    int height = beatsin8(30 + bar*5, 0, 255);
+    if (i % (activeLeds/8) < height * (activeLeds/8) / 255) {
+      leds[i] = ctx.palette[(uint8_t)(bar*32)];
+    } else {
+      leds[i] = CRGB::Black;
+    }
+  }
+}
+
+// Snake
+void pattern_1d_snake(CRGB* leds, int activeLeds, const FrameContext& ctx, StripPositionState& s) {
+  int& snakePos = s.pos;
+  const int snakeLen = 10;
+  fill_solid(leds, activeLeds, CRGB::Black);
+  for(int i=0; i<snakeLen; i++) {
+    int pos = (snakePos - i + activeLeds) % activeLeds;
+    leds[pos] = paletteColor(ctx.palette, 96, 255 - i*20);
+  }
+  snakePos = (snakePos + ctx.steps) % activeLeds;
+}
+
+// Pulse Wave
+void pattern_1d_pulse_wave(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  for(int i=0; i<activeLeds; i++) {
+    uint8_t wave = sin8((i * 20) + (ctx.hue * 3));
+    leds[i] = paletteColor(ctx.palette, ctx.hue, wave);
+  }
+  ctx.hue += 2 * ctx.steps;
+}
+
+// Color Explosion
+void pattern_1d_color_explosion(CRGB* leds, int activeLeds, const FrameContext& ctx, StripExplosionState& s) {
+  if (!s.started) {
+    s.center = activeLeds/2;
+    s.started = true;
+  }
+  int& explosionCenter = s.center;
+  int& explosionRadius = s.radius;
+  for (uint8_t n = 0; n < ctx.steps; n++) {
+    fadeToBlackBy(leds, activeLeds, 20);
+    for(int i=0; i<activeLeds; i++) {
+      int dist = abs(i - explosionCenter);
+      if (dist == explosionRadius) {
+        leds[i] = ctx.palette[ctx.hue];
+      }
+    }
+    explosionRadius++;
+    if (explosionRadius > activeLeds/2) {
+      explosionRadius = 0;
+      explosionCenter = random16(activeLeds);
+      ctx.hue += 32;
+    }
+  }
+}
+
+// Digital Rain
+void pattern_1d_digital_rain(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  for (uint8_t n = 0; n < ctx.steps; n++) {
+    for(int i=activeLeds-1; i>0; i--) {
+      leds[i] = leds[i-1];
+      leds[i].fadeToBlackBy(10);
+    }
+    if (random8() < 30) {
+      leds[0] = CRGB::Green;
+    } else {
+      leds[0] = CRGB::Black;
+    }
+  }
+}
+
+// Heartbeat Wave
+void pattern_1d_heartbeat_wave(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  uint8_t beat = beatsin8(60, 0, 255);
+  for(int i=0; i<activeLeds; i++) {
+    uint8_t wave = sin8((i * 10) + (ctx.hue));
+    leds[i] = CRGB(beat, 0, wave/4);
+  }
+  ctx.hue += ctx.steps;
+}
+
+// Thunderstorm
+void pattern_1d_thunderstorm(CRGB* leds, int activeLeds, const FrameContext& ctx, StripTimestampState& s) {
+  for (uint8_t n = 0; n < ctx.steps; n++) {
+    fadeToBlackBy(leds, activeLeds, 30);
+    if (random8() < 2) {
+      fill_solid(leds, activeLeds, CRGB::White);
+      s.last = ctx.now;
+    } else if (ctx.now - s.last < 100) {
+      fill_solid(leds, activeLeds, CRGB(128, 128, 255));
+    } else {
+      for(int i=0; i<activeLeds; i++) {
+        leds[i] = CRGB(0, 0, random8(20));
+      }
+    }
+  }
+}
+
+// Rainbow Fade
+void pattern_1d_rainbow_fade(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  fill_solid(leds, activeLeds, ctx.palette[ctx.hue]);
+  ctx.hue += ctx.steps;
+}
+
+// Disco Strobe
+void pattern_1d_disco_strobe(CRGB* leds, int activeLeds, const FrameContext& ctx, StripTimestampState& s) {
+  if (ctx.now - s.last > 100) {
+    fill_solid(leds, activeLeds, paletteColor(ctx.palette, random8(), random8() % 2 ? 255 : 0));
+    s.last = ctx.now;
+  }
+}
+
+// Biohazard
+void pattern_1d_biohazard(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  for(int i=0; i<activeLeds; i++) {
+    if (((i + ctx.hue/4) % 3) == 0) leds[i] = CRGB::Yellow;
+    else leds[i] = CRGB::Black;
+  }
+  ctx.hue += ctx.steps;
+}
+
+// Ocean Depth
+void pattern_1d_ocean_depth(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  for(int i=0; i<activeLeds; i++) {
+    uint8_t depth = 255 - (i * 255 / activeLeds);
+    uint8_t shimmer = sin8((i * 5) + ctx.hue);
+    leds[i] = paletteColor(ctx.palette, 160, (depth + shimmer) / 2);
+  }
+  ctx.hue += ctx.steps;
+}
+
+// Pixel Sort
+void pattern_1d_pixel_sort(CRGB* leds, int activeLeds, const FrameContext& ctx, StripPixelSortState& s) {
+  uint8_t& sortPhase = s.sortPhase;
+
+  // Initialize with distinct colors only once
+  if (!s.initialized) {
+    for(int i=0; i<activeLeds; i++) {
+      // Use very distinct hues and medium brightness
+      leds[i] = paletteColor(ctx.palette, random8() & 0xE0, random8(100, 180));
+    }
+    s.initialized = true;
+    sortPhase = 0;
+  }
+
+  // Slow down the sorting - only swap every 100ms
+  if (ctx.now - s.lastSwap > 100) {
+    // Bubble sort by HUE - one pass per frame
+    for(int i=0; i<activeLeds-1; i++) {
+      if ((i + sortPhase) % 2 == 0) {
+        // Sort by ctx.hue instead of brightness
+        CHSV hsv1 = rgb2hsv_approximate(leds[i]);
+        CHSV hsv2 = rgb2hsv_approximate(leds[i+1]);
+        if (hsv1.hue > hsv2.hue) {
+          CRGB temp = leds[i];
+          leds[i] = leds[i+1];
+          leds[i+1] = temp;
+        }
+      }
+    }
+    sortPhase++;
+    s.lastSwap = ctx.now;
+  }
+
+  // Keep sorted for 3 seconds before scrambling
+  if (sortPhase > 200) {
+    s.initialized = false;
+    sortPhase = 0;
+  }
+}
+
+// Glitch
+void pattern_1d_glitch(CRGB* leds, int activeLeds, const FrameContext& ctx, StripTimestampState& s) {
+  for (uint8_t n = 0; n < ctx.steps; n++) {
+    if (random8() < 5 || ctx.now - s.last < 50) {
+      int glitchPos = random16(activeLeds);
+      int glitchLen = random8(5, 20);
+      for(int i=0; i<glitchLen && (glitchPos+i)<activeLeds; i++) {
+        leds[glitchPos+i] = ctx.palette[random8()];
+      }
+      s.last = ctx.now;
+    } else {
+      fadeToBlackBy(leds, activeLeds, 50);
+    }
+  }
+}
+
+// Tron
+void pattern_1d_tron(CRGB* leds, int activeLeds, const FrameContext& ctx, StripPositionState& s) {
+  int& tronPos = s.pos;
+  for (uint8_t n = 0; n < ctx.steps; n++) {
+    fadeToBlackBy(leds, activeLeds, 30);
+    leds[tronPos] = CRGB(0, 255, 255);
+    if (tronPos > 0) leds[tronPos-1] = CRGB(0, 128, 255);
+    if (tronPos > 1) leds[tronPos-2] = CRGB(0, 64, 255);
+    tronPos = (tronPos + 1) % activeLeds;
+  }
+}
+
+// Ember
+void pattern_1d_ember(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  for(int i=0; i<activeLeds; i++) {
+    uint8_t heat = qsub8(inoise8(i*15, ctx.hue*2), abs8(i - (activeLeds/2)));
+    leds[i] = CRGB(heat, heat/4, 0);
+  }
+  ctx.hue += ctx.steps;
+}
+
+// Aurora Borealis
+void pattern_1d_aurora_borealis(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  for(int i=0; i<activeLeds; i++) {
+    uint8_t wave1 = sin8((i * 7) + (ctx.hue * 2));
+    uint8_t wave2 = sin8((i * 11) + (ctx.hue * 3));
+    uint8_t colorIndex = 80 + (wave1 / 6);
+    leds[i] = CHSV(colorIndex, 200, (wave1 + wave2) / 2);
+  }
+  ctx.hue += ctx.steps;
+}
+
+// Neon Pulse
+void pattern_1d_neon_pulse(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  uint8_t pulse = beatsin8(30, 50, 255);
+  for(int i=0; i<activeLeds; i++) {
+    uint8_t colorSection = (i * 256) / activeLeds;
+    leds[i] = paletteColor(ctx.palette, colorSection, pulse);
+  }
+}
+
+// Rainbow Ripple
+void pattern_1d_rainbow_ripple(CRGB* leds, int activeLeds, const FrameContext& ctx, StripRippleState& s) {
+  if (!s.started) {
+    s.center = activeLeds/2;
+    s.started = true;
+  }
+  int& rippleCenter = s.center;
+  for(int i=0; i<activeLeds; i++) {
+    int dist = abs(i - rippleCenter);
+    uint8_t brightness = sin8((dist * 20) - (ctx.hue * 3));
+    leds[i] = paletteColor(ctx.palette, ctx.hue + dist*5, brightness);
+  }
+  ctx.hue += 2 * ctx.steps;
+  if (s.move.every(ctx.now, 3000)) {
+    rippleCenter = random16(activeLeds);
+  }
+}
+
+// Kaleidoscope
+void pattern_1d_kaleidoscope(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  for(int i=0; i<activeLeds/2; i++) {
+    uint8_t color = sin8((i * 10) + ctx.hue);
+    leds[i] = ctx.palette[color];
+    leds[activeLeds-1-i] = ctx.palette[color];
+  }
+  ctx.hue += 2 * ctx.steps;
+}
+
+// DNA Helix
+void pattern_1d_dna_helix(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  for(int i=0; i<activeLeds; i++) {
+    uint8_t wave1 = sin8((i * 15) + ctx.hue);
+    uint8_t wave2 = sin8((i * 15) - ctx.hue);
+    if (wave1 > 128) leds[i] = CRGB::Blue;
+    else if (wave2 > 128) leds[i] = CRGB::Green;
+    else leds[i] = CRGB::Black;
+  }
+  ctx.hue += ctx.steps;
+}
+
+// Fireworks
+void pattern_1d_fireworks(CRGB* leds, int activeLeds, const FrameContext& ctx, StripFireworksState& s) {
+  int& burstPos = s.burstPos;
+  int& burstPhase = s.burstPhase;
+  for (uint8_t n = 0; n < ctx.steps; n++) {
+    fadeToBlackBy(leds, activeLeds, 20);
+    if (ctx.now - s.lastBurst > 2000) {
+      burstPos = random16(activeLeds);
+      burstPhase = 0;
+      s.lastBurst = ctx.now;
+    }
+    if (burstPhase < 20) {
+      for(int i=-burstPhase; i<=burstPhase; i++) {
+        int pos = burstPos + i;
+        if (pos >= 0 && pos < activeLeds) {
+          leds[pos] = paletteColor(ctx.palette, ctx.hue, 255 - burstPhase*10);
+        }
+      }
+      burstPhase++;
+    }
+  }
+}
+
+// VU Meter
+void pattern_1d_vu_meter(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  int level = beatsin8(40, 0, activeLeds);
+  for(int i=0; i<activeLeds; i++) {
+    if (i < level) {
+      if (i < activeLeds/3) leds[i] = CRGB::Green;
+      else if (i < activeLeds*2/3) leds[i] = CRGB::Yellow;
+      else leds[i] = CRGB::Red;
+    } else {
+      leds[i] = CRGB::Black;
+    }
+  }
+}
+
+// Spinning Wheel
+void pattern_1d_spinning_wheel(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  for(int i=0; i<activeLeds; i++) {
+    uint8_t spoke = ((i * 8 / activeLeds) + (ctx.hue / 32)) % 8;
+    if (spoke % 2) {
+      leds[i] = ctx.palette[(uint8_t)(spoke * 32)];
+    } else {
+      leds[i] = CRGB::Black;
+    }
+  }
+  ctx.hue += 2 * ctx.steps;
+}
+
+// Color Bands
+void pattern_1d_color_bands(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  for(int i=0; i<activeLeds; i++) {
+    leds[i] = ctx.palette[((i + ctx.hue) * 256 / activeLeds) % 256];
+  }
+  ctx.hue += ctx.steps;
+}
+
+// Starfield
+void pattern_1d_starfield(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  for (uint8_t n = 0; n < ctx.steps; n++) {
+    fadeToBlackBy(leds, activeLeds, 10);
+    if (random8() < 30) {
+      leds[random16(activeLeds)] = CRGB::White;
+    }
+  }
+}
+
+// Binary Counter
+void pattern_1d_binary_counter(CRGB* leds, int activeLeds, const FrameContext& ctx, StripCounterState& s) {
+  for(int i=0; i<min(8, activeLeds); i++) {
+    leds[i] = (s.counter & (1 << i)) ? CRGB::Green : CRGB::Black;
+  }
+  s.counter += s.tick.every(ctx.now, 200);
+}
+
+// Breathing Rainbow
+void pattern_1d_breathing_rainbow(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  uint8_t brightness = beatsin8(20, 50, 255);
+  fill_rainbow(leds, activeLeds, ctx.hue, 255/activeLeds);
+  for(int i=0; i<activeLeds; i++) {
+    leds[i].nscale8(brightness);
+  }
+  ctx.hue += ctx.steps;
+}
+
+// Wave Interference
+void pattern_1d_wave_interference(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  for(int i=0; i<activeLeds; i++) {
+    uint8_t wave1 = sin8((i * 10) + (ctx.hue * 2));
+    uint8_t wave2 = sin8((i * 15) + (ctx.hue * 3));
+    leds[i] = paletteColor(ctx.palette, ctx.hue, (wave1 + wave2) / 2);
+  }
+  ctx.hue += ctx.steps;
+}
+
+// Bouncing Ball
+void pattern_1d_bouncing_ball(CRGB* leds, int activeLeds, const FrameContext& ctx, StripBouncingBallState& s) {
+  float& ballPos = s.ballPos;
+  float& ballVel = s.ballVel;
+  for (uint8_t n = 0; n < ctx.steps; n++) {
+    fadeToBlackBy(leds, activeLeds, 100);
+    ballVel += 0.5;
+    ballPos += ballVel;
+    if (ballPos >= activeLeds-1) {
+      ballPos = activeLeds-1;
+      ballVel *= -0.85;
+    }
+    leds[(int)ballPos] = ctx.palette[ctx.hue];
+    if (s.hueStep.every(ctx.now, 10000)) { ctx.hue += 32; }
+  }
+}
+
+// Color Temperature - Moving Hot Spot (with fade & slower speed)
+void pattern_1d_color_temperature(CRGB* leds, int activeLeds, const FrameContext& ctx, StripHotSpotState& s) {
+  int& hotSpot = s.hotSpot;
+  // Fade trail so the hot spot leaves a subtle glow
+  fadeToBlackBySteps(leds, activeLeds, 20, ctx.steps);
+  // Move the hot spot every 100 ms for a smoother pace
+  if (ctx.now - s.lastMove > 100) {
+    for(int i=0; i<activeLeds; i++) {
+      int dist = abs(i - hotSpot);
+      float temp;
+      if (dist < 5) {
+        // Very hot - white/yellow
+        temp = 1.0 - (dist / 5.0);
+        leds[i] = CRGB(255, 255, 255 - temp * 100);
+      } else if (dist < 15) {
+        // Hot - orange/red
+        temp = (dist - 5.0) / 10.0;
+        leds[i] = CRGB(255, 200 - temp * 150, 50 - temp * 50);
+      } else if (dist < 30) {
+        // Warm - dark red
+        temp = (dist - 15.0) / 15.0;
+        leds[i] = CRGB(255 - temp * 205, 50 - temp * 50, 0);
+      } else {
+        // Cool - blue
+        leds[i] = CRGB(0, 0, 100);
+      }
+    }
+    hotSpot++;
+    if (hotSpot >= activeLeds) hotSpot = 0;
+    s.lastMove = ctx.now;
+  }
+}
+
+// Police Siren
+void pattern_1d_police_siren(CRGB* leds, int activeLeds, const FrameContext& ctx, StripSirenState& s) {
+  if (ctx.now - s.lastSwitch > 300) {
+    s.isRed = !s.isRed;
+    s.lastSwitch = ctx.now;
+  }
+  bool isRed = s.isRed;
+  for(int i=0; i<activeLeds; i++) {
+    if (i < activeLeds/2) leds[i] = isRed ? CRGB::Red : CRGB::Black;
+    else leds[i] = isRed ? CRGB::Black : CRGB::Blue;
+  }
+}
+
+// Candy Stripes
+void pattern_1d_candy_stripes(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  for(int i=0; i<activeLeds; i++) {
+    int stripe = (i + ctx.hue/4) % 6;
+    if (stripe < 3) leds[i] = CRGB::Red;
+    else leds[i] = CRGB::White;
+  }
+  ctx.hue += ctx.steps;
+}
+
+// Pixel Rain
+void pattern_1d_pixel_rain(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  for (uint8_t n = 0; n < ctx.steps; n++) {
+    for(int i=activeLeds-1; i>0; i--) {
+      leds[i] = leds[i-1];
+    }
+    if (random8() < 40) {
+      leds[0] = ctx.palette[random8()];
+    } else {
+      leds[0] = CRGB::Black;
+    }
+  }
+}
+
+// Energy Field
+void pattern_1d_energy_field(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  for(int i=0; i<activeLeds; i++) {
+    uint8_t noise = inoise8(i*30, ctx.hue*2);
+    leds[i] = paletteColor(ctx.palette, 160, noise);
+  }
+  ctx.hue += ctx.steps;
+}
+
+// Orbit
+void pattern_1d_orbit(CRGB* leds, int activeLeds, const FrameContext& ctx) {
+  fadeToBlackBySteps(leds, activeLeds, 30, ctx.steps);
+  int planet1 = beatsin16(10, 0, activeLeds-1);
+  int planet2 = beatsin16(13, 0, activeLeds-1, 0, 16384);
+  leds[planet1] = CRGB::Yellow;
+  leds[planet2] = CRGB::Blue;
+}
+
+// Pulse Ring
+void pattern_1d_pulse_ring(CRGB* leds, int activeLeds, const FrameContext& ctx, StripPositionState& s) {
+  int& ringPos = s.pos;
+  const int ringSize = 5;
+  fill_solid(leds, activeLeds, CRGB::Black);
+  for(int i=-ringSize; i<=ringSize; i++) {
+    int pos = ringPos + i;
+    if (pos >= 0 && pos < activeLeds) {
+      leds[pos] = paletteColor(ctx.palette, ctx.hue, 255 - abs(i)*40);
+    }
+  }
+  ringPos += ctx.steps;
+  if (ringPos >= activeLeds + ringSize) {
+    ringPos = -ringSize;
+    ctx.hue += 32;
+  }
+}
+
+// Random Walk
+void pattern_1d_random_walk(CRGB* leds, int activeLeds, const FrameContext& ctx, StripWalkerState& s) {
+  if (!s.started) {
+    s.walker = activeLeds/2;
+    s.started = true;
+  }
+  int& walker = s.walker;
+  for (uint8_t n = 0; n < ctx.steps; n++) {
+    fadeToBlackBy(leds, activeLeds, 20);
+    walker += random8(3) - 1;
+    if (walker < 0) walker = 0;
+    if (walker >= activeLeds) walker = activeLeds-1;
+    leds[walker] = ctx.palette[ctx.hue];
+    ctx.hue++;
+  }
+}
+
+// Supernova
+void pattern_1d_supernova(CRGB* leds, int activeLeds, const FrameContext& ctx, StripSupernovaState& s) {
+  int& novaPhase = s.novaPhase;
+  for (uint8_t n = 0; n < ctx.steps; n++) {
+    if (ctx.now - s.lastNova > 3000 || novaPhase > 0) {
+      if (novaPhase == 0) s.lastNova = ctx.now;
+      int brightness = (novaPhase < 10) ? novaPhase * 25 : max(0, 255 - (novaPhase - 10) * 10);
+      fill_solid(leds, activeLeds, CRGB(brightness, brightness, brightness/2));
+      novaPhase++;
+      if (novaPhase > 35) novaPhase = 0;
+    } else {
+      fadeToBlackBy(leds, activeLeds, 5);
+    }
+  }
+}
+
+#endif // SIMULATOR
@@ -11,15 +11,16 @@
   // Mock PROGMEM for simulator
   #define PROGMEM
   #define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+  #define memcpy_P(dst, src, len) memcpy((dst), (src), (len))
 
   // Mock millis() for simulator
   #include <chrono>
-  #ifdef SIM_WASM
+  #if defined(SIM_WASM) || defined(SIM_NATIVE)
     extern unsigned long (*sim_millis_fn)();
   #endif
 
   inline unsigned long millis() {
-  #ifdef SIM_WASM
+  #if defined(SIM_WASM) || defined(SIM_NATIVE)
     if (sim_millis_fn) {
       return sim_millis_fn();
     }
@@ -29,34 +30,15 @@
     return std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count();
   }
 
-// Timer helpers (lightweight stand-ins for FastLED EVERY_N_* macros)
-#ifndef EVERY_N_MILLISECONDS
-#define _EVERY_N_HELPER(token, interval_ms) \
-  for (static unsigned long _last_##token = 0; ((millis() - _last_##token) >= (interval_ms)) ? (_last_##token = millis(), true) : false; )
-#define EVERY_N_MILLISECONDS(x) _EVERY_N_HELPER(__LINE__, (x))
-#define EVERY_N_SECONDS(x) _EVERY_N_HELPER(__LINE__, (uint32_t)(x) * 1000UL)
-#endif
+// No EVERY_N_* shim: patterns keep a PatternTimer (patterns.h) in their state instead.
 
-  // Mock random for simulator
-  inline uint8_t random8() {
-    return rand() % 256;
-  }
+  // Integer FastLED math (scale8, sin8/sin16, beat*, hsv2rgb_rainbow)
+  #include "sim_lib8tion.h"
+  // Byte kernels for the framebuffer helpers below (SIMD with -DSIM_SIMD)
+  #include "sim_simd.h"
+  #include <vector>
 
-  inline uint8_t random8(uint8_t lim) {
-    return rand() % lim;
-  }
-
-  inline uint8_t random8(uint8_t min, uint8_t max) {
-    return min + (rand() % (max - min));
-  }
-
-  inline uint16_t random16() {
-    return rand() % 65536;
-  }
-
-inline uint16_t random16(uint16_t lim) {
-  return rand() % lim;
-}
+  // random8/random16 are FastLED's LCG (sim_lib8tion.h): same sequence as the device
 
 // Arduino-compatible aliases
 using byte = uint8_t;
@@ -84,6 +66,16 @@ using byte = uint8_t;
   // Use FastLED's CRGB
   // (already included above)
 #else
+  // FastLED-style HSV color; converts to CRGB through hsv2rgb_rainbow like on the device
+  struct CHSV {
+    uint8_t hue;
+    uint8_t sat;
+    uint8_t val;
+
+    CHSV() : hue(0), sat(0), val(0) {}
+    CHSV(uint8_t h, uint8_t s, uint8_t v) : hue(h), sat(s), val(v) {}
+  };
+
   // Define our own CRGB for simulator
   struct CRGB {
     uint8_t r;
@@ -92,11 +84,23 @@ using byte = uint8_t;
 
     CRGB() : r(0), g(0), b(0) {}
     CRGB(uint8_t r, uint8_t g, uint8_t b) : r(r), g(g), b(b) {}
+    CRGB(const CHSV& hsv) { hsv2rgb_rainbow(hsv.hue, hsv.sat, hsv.val, r, g, b); }
+
+    inline CRGB& nscale8(uint8_t scale) {
+      nscale8x3(r, g, b, scale);
+      return *this;
+    }
+
+    // Same as FastLED: a scale, not a subtraction
+    inline CRGB& fadeToBlackBy(uint8_t amount) {
+      return nscale8(255 - amount);
+    }
 
-    inline void fadeToBlackBy(uint8_t amount) {
-      r = (amount > r) ? 0 : static_cast<uint8_t>(r - amount);
-      g = (amount > g) ? 0 : static_cast<uint8_t>(g - amount);
-      b = (amount > b) ? 0 : static_cast<uint8_t>(b - amount);
+    inline CRGB& operator+=(const CRGB& rhs) {
+      r = qadd8(r, rhs.r);
+      g = qadd8(g, rhs.g);
+      b = qadd8(b, rhs.b);
+      return *this;
     }
 
     // Named colors
@@ -124,82 +128,26 @@ using byte = uint8_t;
   inline const CRGB CRGB::Magenta = CRGB(255, 0, 255);
   inline const CRGB CRGB::White   = CRGB(255, 255, 255);
 
-  // CHSV to RGB conversion
-  inline CRGB CHSV(uint8_t h, uint8_t s, uint8_t v) {
-    float hue = h / 255.0f;
-    float sat = s / 255.0f;
-    float val = v / 255.0f;
-
-    float r, g, b;
-    int i = (int)(hue * 6);
-    float f = hue * 6 - i;
-    float p = val * (1 - sat);
-    float q = val * (1 - f * sat);
-    float t = val * (1 - (1 - f) * sat);
-
-    switch (i % 6) {
-      case 0: r = val; g = t; b = p; break;
-      case 1: r = q; g = val; b = p; break;
-      case 2: r = p; g = val; b = t; break;
-      case 3: r = p; g = q; b = val; break;
-      case 4: r = t; g = p; b = val; break;
-      case 5: r = val; g = p; b = q; break;
-    }
-
-    return CRGB(r * 255, g * 255, b * 255);
-  }
-
-  // FastLED helper functions
-  inline uint8_t sin8(uint8_t theta) {
-    return (sin(theta * M_PI / 128.0) + 1.0) * 127.5;
-  }
+  // The array helpers treat leds as numLeds * 3 packed bytes (see sim_simd.h)
+  static_assert(sizeof(CRGB) == 3, "CRGB must be packed r,g,b");
 
-  inline uint8_t cos8(uint8_t theta) {
-    return (cos(theta * M_PI / 128.0) + 1.0) * 127.5;
-  }
-
-  inline uint8_t beatsin8(uint8_t bpm, uint8_t lowest = 0, uint8_t highest = 255,
-                          uint32_t timebase = 0, uint8_t phase_offset = 0) {
-    uint32_t ms = millis() + timebase;
-    uint16_t beats = (ms * bpm) / 60000;
-    uint8_t phase = (beats & 0xFF) + phase_offset;
-    uint8_t sinval = sin8(phase);
-    return lowest + ((sinval * (highest - lowest)) >> 8);
-  }
-
-  inline uint16_t beatsin16(uint16_t bpm, uint16_t lowest = 0, uint16_t highest = 65535,
-                            uint32_t timebase = 0, uint16_t phase_offset = 0) {
-    return beatsin8(bpm, lowest >> 8, highest >> 8, timebase, phase_offset >> 8) << 8;
-  }
-
-  inline uint8_t qadd8(uint8_t a, uint8_t b) {
-    unsigned int sum = a + b;
-    if (sum > 255) sum = 255;
-    return sum;
-  }
-
-  inline uint8_t qsub8(uint8_t a, uint8_t b) {
-    if (a < b) return 0;
-    return a - b;
+  inline void fill_solid(CRGB* leds, int numLeds, const CRGB& color) {
+    if (numLeds <= 0) return;
+    fill3_bytes(reinterpret_cast<uint8_t*>(leds), numLeds, color.r, color.g, color.b);
   }
 
-  inline void fill_solid(CRGB* leds, int numLeds, const CRGB& color) {
-    for (int i = 0; i < numLeds; i++) {
-      leds[i] = color;
-    }
+  inline void nscale8(CRGB* leds, int numLeds, uint8_t scale) {
+    if (numLeds <= 0) return;
+    scale8_bytes(reinterpret_cast<uint8_t*>(leds), numLeds * 3, scale);
   }
 
   inline void fadeToBlackBy(CRGB* leds, int numLeds, uint8_t amount) {
-    for (int i = 0; i < numLeds; i++) {
-      leds[i].r = qsub8(leds[i].r, amount);
-      leds[i].g = qsub8(leds[i].g, amount);
-      leds[i].b = qsub8(leds[i].b, amount);
-    }
+    nscale8(leds, numLeds, 255 - amount);
   }
 
   inline CRGB HeatColor(uint8_t temperature) {
     // Heat ramp: black -> red -> yellow -> white
-    uint8_t t192 = (temperature * 191) / 255;
+    uint8_t t192 = scale8_video(temperature, 191);
     uint8_t heatramp = t192 & 0x3F;
     heatramp <<= 2;
 
@@ -212,22 +160,22 @@ using byte = uint8_t;
     }
   }
 
-  inline uint8_t inoise8(uint16_t x, uint16_t y = 0, uint16_t z = 0) {
-    // Simplified noise function
-    float nx = x * 0.01f;
-    float ny = y * 0.01f;
-    float nz = z * 0.01f;
-    float n = sin(nx) * cos(ny) * sin(nz);
-    return ((n + 1.0f) * 0.5f) * 255;
-  }
-
+  // FastLED blur1d: each pixel keeps 255-amount and leaks amount/2 to each neighbour.
+  // Same result as FastLED's carry loop, computed as
+  //   out[i] = qadd8(qadd8(keep(in[i]), seep(in[i-1])), seep(in[i+1]))
+  // so it runs as whole-buffer byte kernels.
   inline void blur1d(CRGB* leds, int numLeds, uint8_t amount) {
-    // Simple 3-point blur
-    for (int i = 1; i < numLeds - 1; i++) {
-      leds[i].r = (leds[i-1].r + leds[i].r + leds[i+1].r) / 3;
-      leds[i].g = (leds[i-1].g + leds[i].g + leds[i+1].g) / 3;
-      leds[i].b = (leds[i-1].b + leds[i].b + leds[i+1].b) / 3;
-    }
+    if (numLeds <= 0) return;
+    const int n = numLeds * 3;
+    uint8_t* bytes = reinterpret_cast<uint8_t*>(leds);
+    // Seeped share of every byte, with one black pixel of padding on each side
+    static std::vector<uint8_t> seep;
+    seep.assign(n + 6, 0);
+    memcpy(seep.data() + 3, bytes, n);
+    scale8_bytes(seep.data() + 3, n, amount >> 1);
+    scale8_bytes(bytes, n, 255 - amount);
+    qadd8_bytes(bytes, seep.data(), n);      // from the left neighbour
+    qadd8_bytes(bytes, seep.data() + 6, n);  // from the right neighbour
   }
 #endif
 
@@ -0,0 +1,278 @@
+#ifndef REALTIME_RECEIVER_H
+#define REALTIME_RECEIVER_H
+
+#include "platform.h"
+#include "led_map.h"
+
+// Realtime pixel input from a show controller: E1.31 (sACN, UDP 5568) and DDP (UDP 4048).
+// Packets are parsed from their source - a WiFiUDP on the device, a memory span natively -
+// and the pixel payload is read straight into leds[], so there is no frame buffer between
+// the network and the LEDs.
+//
+//   receiver.begin(leds, activeLeds);
+//   int len = udp.parsePacket();
+//   if (len > 0) receiver.receiveE131(udp, len, millis());
+//   if (receiver.active(millis()) && receiver.takeFrame()) ...show leds...
+//
+// The controller's channel space starts at LED 0: RGB per LED, E1.31 universes from
+// firstUniverse on with channelsPerUniverse channels each (510 = 170 LEDs), DDP by byte
+// offset. MAP_GRID treats it as the GRID_WIDTH x GRID_HEIGHT matrix in row-major order and
+// places each pixel through the wiring table (xyRow), so controllers need not know the
+// layout; MAP_STRIP writes strip order as is. LEDs past the grid follow in strip order.
+//
+// A frame is complete on a DDP push, on an E1.31 sync packet for the sync address the data
+// named, or - without sync - when the last universe of the chain (or one already seen this
+// frame) arrives. E1.31 packets older than the universe's last sequence number (within the
+// spec's window of 20) and repeated DDP sequence numbers are dropped. Without packets for
+// timeoutMs (or after an E1.31 stream-terminated packet) active() turns false, and the
+// caller goes back to its local pattern.
+class RealtimeReceiver {
+ public:
+  enum Protocol : uint8_t { PROTO_NONE, PROTO_E131, PROTO_DDP };
+  enum Mapping : uint8_t { MAP_GRID, MAP_STRIP };
+
+  static const uint16_t kE131Port = 5568;
+  static const uint16_t kDdpPort = 4048;
+  static const int kMaxUniverses = 32;
+  static const int kE131HeaderBytes = 126;  // up to and including the DMX start code
+  static const int kE131SyncBytes = 49;
+
+  struct Stats {
+    uint32_t packets;     // accepted data packets
+    uint32_t frames;      // completed frames
+    uint32_t dropped;     // malformed, preview or foreign packets
+    uint32_t outOfOrder;  // stale or repeated sequence numbers
+    uint32_t syncs;       // E1.31 sync packets that released a frame
+  };
+
+  RealtimeReceiver()
+      : leds_(nullptr), count_(0), firstUniverse_(1), channelsPerUniverse_(510), mapping_(MAP_GRID),
+        timeoutMs_(2500) {
+    reset();
+  }
+
+  void begin(CRGB* leds, int count) {
+    leds_ = leds;
+    count_ = count;
+  }
+
+  void configure(uint16_t firstUniverse, Mapping mapping, uint32_t timeoutMs) {
+    firstUniverse_ = firstUniverse > 0 ? firstUniverse : 1;
+    mapping_ = mapping;
+    timeoutMs_ = timeoutMs;
+    reset();
+  }
+
+  void setLedCount(int count) { count_ = count; }
+
+  // Receives an E1.31 data or sync packet of `len` bytes from `src`, which has
+  // read(uint8_t*, size_t). Returns true if pixels were written.
+  template <typename Source>
+  bool receiveE131(Source& src, int len, unsigned long nowMs) {
+    uint8_t h[kE131HeaderBytes];
+    int head = len < kE131HeaderBytes ? len : kE131HeaderBytes;
+    if (head < kE131SyncBytes || readBytes(src, h, head) != head || !isE131(h)) return drop();
+    uint32_t rootVector = be32(h + 18);
+    uint32_t frameVector = be32(h + 40);
+    if (rootVector == 0x08 && frameVector == 0x01) {  // extended: synchronization
+      uint16_t address = be16(h + 45);
+      if (syncPending_ && address == syncAddress_) {
+        syncPending_ = false;
+        stats_.syncs++;
+        completeFrame();
+      }
+      return false;
+    }
+    if (rootVector != 0x04 || frameVector != 0x02 || head < kE131HeaderBytes) return drop();
+    uint8_t options = h[112];
+    if (options & 0x40) return drop();  // preview data, not for output
+    if (options & 0x20) {               // source is going away: fall back now
+      lastPacketMs_ = 0;
+      live_ = false;
+      return false;
+    }
+    if (h[117] != 0x02 || h[118] != 0xA1 || h[125] != 0) return drop();  // DMP set property, DMX512 data
+    uint16_t universe = be16(h + 113);
+    int slot = (int)universe - firstUniverse_;
+    if (slot < 0 || slot >= kMaxUniverses) return drop();
+
+    uint8_t seq = h[111];
+    uint32_t bit = 1u << slot;
+    if (seqSeen_ & bit) {
+      int8_t diff = (int8_t)(seq - seq_[slot]);
+      if (diff <= 0 && diff > -20) {
+        stats_.outOfOrder++;
+        return false;
+      }
+    }
+    seqSeen_ |= bit;
+    seq_[slot] = seq;
+
+    int channels = (int)be16(h + 123) - 1;
+    if (channels > channelsPerUniverse_) channels = channelsPerUniverse_;
+    if (channels > len - kE131HeaderBytes) channels = len - kE131HeaderBytes;
+    if (channels < 0) return drop();
+
+    uint16_t syncAddress = be16(h + 109);
+    // Without sync, a universe already written this frame means the previous one is done
+    if (!syncAddress && (universesThisFrame_ & bit)) completeFrame();
+    writeChannels(src, (uint32_t)slot * channelsPerUniverse_, channels);
+    accepted(PROTO_E131, nowMs);
+    universesThisFrame_ |= bit;
+    if (syncAddress) {
+      syncPending_ = true;
+      syncAddress_ = syncAddress;
+    } else if (slot + 1 >= universesForChain()) {
+      completeFrame();
+    }
+    return true;
+  }
+
+  // Receives a DDP packet of `len` bytes from `src`. Returns true if pixels were written.
+  template <typename Source>
+  bool receiveDdp(Source& src, int len, unsigned long nowMs) {
+    uint8_t h[14];
+    if (len < 10 || readBytes(src, h, 10) != 10) return drop();
+    uint8_t flags = h[0];
+    if ((flags >> 6) != 1 || (flags & 0x06)) return drop();  // version 1, not a query / reply
+    int header = 10;
+    if (flags & 0x10) {  // timecode, not used
+      if (len < 14 || readBytes(src, h + 10, 4) != 4) return drop();
+      header = 14;
+    }
+    if ((h[2] != 0 && h[2] != 0x0B) || h[3] > 1) return drop();  // RGB 8 bit, default output
+    uint8_t seq = h[1] & 0x0F;
+    if (seq != 0 && seq == ddpSeq_) {
+      stats_.outOfOrder++;
+      return false;
+    }
+    ddpSeq_ = seq;
+    uint32_t offset = be32(h + 4);
+    int length = be16(h + 8);
+    if (length > len - header) length = len - header;
+    writeChannels(src, offset, length);
+    accepted(PROTO_DDP, nowMs);
+    if (flags & 0x01) completeFrame();  // push
+    return true;
+  }
+
+  // True while a controller is sending (a packet within timeoutMs)
+  bool active(unsigned long nowMs) const { return live_ && nowMs - lastPacketMs_ < timeoutMs_; }
+
+  // True once for every completed frame
+  bool takeFrame() {
+    bool ready = frameReady_;
+    frameReady_ = false;
+    return ready;
+  }
+
+  Protocol protocol() const { return protocol_; }
+  const Stats& stats() const { return stats_; }
+  uint16_t firstUniverse() const { return firstUniverse_; }
+  Mapping mapping() const { return mapping_; }
+  uint32_t timeoutMs() const { return timeoutMs_; }
+  unsigned long lastPacketMs() const { return lastPacketMs_; }
+
+ private:
+  void reset() {
+    memset(&stats_, 0, sizeof(stats_));
+    memset(seq_, 0, sizeof(seq_));
+    seqSeen_ = 0;
+    universesThisFrame_ = 0;
+    ddpSeq_ = 0;
+    syncPending_ = false;
+    syncAddress_ = 0;
+    frameReady_ = false;
+    live_ = false;
+    lastPacketMs_ = 0;
+    protocol_ = PROTO_NONE;
+  }
+
+  static uint16_t be16(const uint8_t* p) { return (uint16_t)((p[0] << 8) | p[1]); }
+  static uint32_t be32(const uint8_t* p) {
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+  }
+
+  static bool isE131(const uint8_t* h) {
+    static const uint8_t kId[12] = { 'A', 'S', 'C', '-', 'E', '1', '.', '1', '7', 0, 0, 0 };
+    return be16(h) == 0x0010 && memcmp(h + 4, kId, sizeof(kId)) == 0;
+  }
+
+  template <typename Source>
+  static int readBytes(Source& src, uint8_t* dst, int n) {
+    return (int)src.read(dst, (size_t)n);
+  }
+
+  bool drop() {
+    stats_.dropped++;
+    return false;
+  }
+
+  void accepted(Protocol p, unsigned long nowMs) {
+    stats_.packets++;
+    protocol_ = p;
+    lastPacketMs_ = nowMs;
+    live_ = true;
+  }
+
+  void completeFrame() {
+    universesThisFrame_ = 0;
+    frameReady_ = true;
+    stats_.frames++;
+  }
+
+  int universesForChain() const {
+    int n = (count_ * 3 + channelsPerUniverse_ - 1) / channelsPerUniverse_;
+    return n < kMaxUniverses ? n : kMaxUniverses;
+  }
+
+  // Strip index of controller pixel p
+  int ledFor(int p) const {
+    if (mapping_ == MAP_GRID && p < GRID_LEDS) return xyRow(p / GRID_WIDTH)[p % GRID_WIDTH];
+    return p;
+  }
+
+  // Reads `n` channel bytes starting at channel `offset` straight into their LEDs
+  template <typename Source>
+  void writeChannels(Source& src, uint32_t offset, int n) {
+    uint32_t limit = (uint32_t)count_ * 3;
+    if (offset >= limit || n <= 0) return;
+    if ((uint32_t)n > limit - offset) n = (int)(limit - offset);
+    uint8_t* base = reinterpret_cast<uint8_t*>(leds_);
+    if (mapping_ == MAP_STRIP) {
+      src.read(base + offset, (size_t)n);
+      return;
+    }
+    while (n > 0) {
+      int p = offset / 3;
+      int sub = offset % 3;
+      int take = 3 - sub < n ? 3 - sub : n;
+      int led = ledFor(p);
+      uint8_t skipped[3];
+      src.read(led < count_ ? base + led * 3 + sub : skipped, (size_t)take);  // grid cells past a short chain
+      offset += take;
+      n -= take;
+    }
+  }
+
+  CRGB* leds_;
+  int count_;
+  uint16_t firstUniverse_;
+  int channelsPerUniverse_;
+  Mapping mapping_;
+  uint32_t timeoutMs_;
+
+  Stats stats_;
+  uint8_t seq_[kMaxUniverses];  // last E1.31 sequence number per universe
+  uint32_t seqSeen_;            // universes with a sequence number
+  uint32_t universesThisFrame_;
+  uint8_t ddpSeq_;
+  bool syncPending_;
+  uint16_t syncAddress_;
+  bool frameReady_;
+  bool live_;
+  unsigned long lastPacketMs_;
+  Protocol protocol_;
+};
+
+#endif // REALTIME_RECEIVER_H
@@ -0,0 +1,220 @@
+#ifndef RENDER_PROFILER_H
+#define RENDER_PROFILER_H
+
+#include "platform.h"
+
+#ifdef SIMULATOR
+#include <chrono>
+#endif
+
+// Cycle-counter timings of the three phases of a frame - the pattern's render, the strip
+// output (FastLED.show(); in the simulator, the output stage that stands in for it) and
+// server.handleClient() - kept per pattern id, for /metrics and sim_get_stats().
+//
+//   profiler.setPattern(currentPattern);
+//   profiler.begin(RenderProfiler::PHASE_RENDER); ...; profiler.end(RenderProfiler::PHASE_RENDER);
+//
+// Each (pattern, phase) keeps min / avg / max and a log2 histogram (four buckets per
+// octave) for the p99. The figures are rolling: every kWindow samples the counts and sums
+// are halved, and min / max cover the current and the previous window only. HTTP time does
+// not depend on the pattern and is kept once.
+//
+// Only the kSlots most recently shown patterns are kept (~2.8 KB); switching to another one
+// reuses the slot of the pattern shown longest ago.
+class RenderProfiler {
+ public:
+  enum Phase : uint8_t { PHASE_RENDER, PHASE_SHOW, PHASE_HTTP, PHASE_COUNT };
+
+  static const int kSlots = 8;
+  static const int kBuckets = 124;     // 0..3, then each octave [2^o, 2^(o+1)) in quarters
+  static const uint32_t kWindow = 128;  // halving keeps every bucket <= 255
+
+  struct Stats {
+    uint32_t count;       // samples in the current and (halved) previous windows
+    uint32_t windowRuns;  // samples since the last halving
+    uint32_t minTicks[2]; // current, previous window
+    uint32_t maxTicks[2];
+    uint64_t totalTicks;
+    uint8_t hist[kBuckets];
+  };
+
+  // Rolling figures in nanoseconds; count = 0 if the phase has no samples yet
+  struct Summary {
+    uint32_t count;
+    uint32_t minNs;
+    uint32_t avgNs;
+    uint32_t maxNs;
+    uint32_t p99Ns;
+    uint64_t sumNs;  // of the `count` samples
+  };
+
+  // Free-running tick counter: CPU cycles on the device, nanoseconds in the simulator.
+  // Wraps (every 26 s at 160 MHz); intervals are unsigned differences.
+  static uint32_t ticks() {
+#ifdef SIMULATOR
+    static const auto start = std::chrono::steady_clock::now();
+    return (uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start).count();
+#else
+    return ESP.getCycleCount();
+#endif
+  }
+
+  static uint64_t ticksToNs(uint64_t t) {
+#ifdef SIMULATOR
+    return t;
+#else
+    return t * 1000 / ESP.getCpuFreqMHz();
+#endif
+  }
+
+  static const char* phaseName(Phase p) {
+    static const char* const kNames[PHASE_COUNT] = { "render", "show", "http" };
+    return kNames[p];
+  }
+
+  RenderProfiler() { reset(); }
+
+  void reset() {
+    memset(slots_, 0, sizeof(slots_));
+    for (int i = 0; i < kSlots; i++) slots_[i].id = -1;
+    clear(http_);
+    current_ = 0;
+    clock_ = 0;
+    memset(begun_, 0, sizeof(begun_));
+  }
+
+  // Pattern the next render / show samples belong to
+  void setPattern(int id) {
+    clock_++;
+    if (slots_[current_].id == id) {
+      slots_[current_].lastUsed = clock_;
+      return;
+    }
+    int pick = 0;
+    for (int i = 0; i < kSlots; i++) {
+      if (slots_[i].id == id) { pick = i; break; }
+      if (slots_[i].lastUsed < slots_[pick].lastUsed) pick = i;
+    }
+    if (slots_[pick].id != id) {
+      slots_[pick].id = id;
+      clear(slots_[pick].stats[PHASE_RENDER]);
+      clear(slots_[pick].stats[PHASE_SHOW]);
+    }
+    slots_[pick].lastUsed = clock_;
+    current_ = pick;
+  }
+
+  void begin(Phase p) { begun_[p] = ticks(); }
+
+  // Records the time since begin(p); returns it in ticks
+  uint32_t end(Phase p) {
+    uint32_t t = ticks() - begun_[p];
+    record(p, t);
+    return t;
+  }
+
+  uint32_t begunAt(Phase p) const { return begun_[p]; }
+
+  void record(Phase p, uint32_t t) {
+    Stats& s = p == PHASE_HTTP ? http_ : slots_[current_].stats[p];
+    if (s.windowRuns == kWindow) {
+      // Start a new window: older samples count half, min / max forget the one before
+      for (int b = 0; b < kBuckets; b++) s.hist[b] >>= 1;
+      s.count >>= 1;
+      s.totalTicks >>= 1;
+      s.minTicks[1] = s.minTicks[0];
+      s.maxTicks[1] = s.maxTicks[0];
+      s.minTicks[0] = 0xFFFFFFFFu;
+      s.maxTicks[0] = 0;
+      s.windowRuns = 0;
+    }
+    s.count++;
+    s.windowRuns++;
+    s.totalTicks += t;
+    if (t < s.minTicks[0]) s.minTicks[0] = t;
+    if (t > s.maxTicks[0]) s.maxTicks[0] = t;
+    s.hist[bucket(t)]++;
+  }
+
+  // Pattern id of a slot, -1 if it is unused
+  int slotPattern(int slot) const { return slots_[slot].id; }
+
+  // Slot of a pattern id, -1 if it is not tracked
+  int findSlot(int id) const {
+    for (int i = 0; i < kSlots; i++) {
+      if (slots_[i].id == id) return i;
+    }
+    return -1;
+  }
+
+  // Rolling figures of a phase; `slot` is ignored for PHASE_HTTP
+  Summary summary(int slot, Phase p) const {
+    const Stats& s = p == PHASE_HTTP ? http_ : slots_[slot].stats[p];
+    Summary out = { 0, 0, 0, 0, 0, 0 };
+    if (s.count == 0) return out;
+    uint32_t lo = s.minTicks[0] < s.minTicks[1] ? s.minTicks[0] : s.minTicks[1];
+    uint32_t hi = s.maxTicks[0] > s.maxTicks[1] ? s.maxTicks[0] : s.maxTicks[1];
+    out.count = s.count;
+    out.minNs = (uint32_t)ticksToNs(lo);
+    out.avgNs = (uint32_t)ticksToNs(s.totalTicks / s.count);
+    out.maxNs = (uint32_t)ticksToNs(hi);
+    out.p99Ns = (uint32_t)ticksToNs(percentile(s, 99, lo, hi));
+    out.sumNs = ticksToNs(s.totalTicks);
+    return out;
+  }
+
+ private:
+  struct Slot {
+    int id;
+    uint32_t lastUsed;
+    Stats stats[2];  // PHASE_RENDER, PHASE_SHOW
+  };
+
+  static void clear(Stats& s) {
+    memset(&s, 0, sizeof(s));
+    s.minTicks[0] = s.minTicks[1] = 0xFFFFFFFFu;
+  }
+
+  static int bucket(uint32_t t) {
+    if (t < 4) return t;
+    int o = 31 - __builtin_clz(t);
+    return 4 * (o - 1) + ((t >> (o - 2)) & 3);
+  }
+
+  static uint32_t bucketLow(int b) {
+    if (b < 4) return b;
+    return (uint32_t)(4 + (b & 3)) << (b / 4 - 1);
+  }
+
+  // Value below which pct % of the samples fall, interpolated within its bucket and kept
+  // inside the observed [lo, hi]
+  static uint32_t percentile(const Stats& s, uint32_t pct, uint32_t lo, uint32_t hi) {
+    uint32_t total = 0;
+    for (int b = 0; b < kBuckets; b++) total += s.hist[b];
+    if (total == 0) return hi;
+    uint32_t rank = (total * pct + 99) / 100;  // 1-based
+    uint32_t seen = 0;
+    for (int b = 0; b < kBuckets; b++) {
+      if (seen + s.hist[b] < rank) {
+        seen += s.hist[b];
+        continue;
+      }
+      uint32_t low = bucketLow(b);
+      uint32_t width = (b + 1 < kBuckets ? bucketLow(b + 1) : 0xFFFFFFFFu) - low;
+      uint32_t v = low + (uint32_t)((uint64_t)width * (rank - seen) / s.hist[b]);
+      if (v < lo) v = lo;
+      if (v > hi) v = hi;
+      return v;
+    }
+    return hi;
+  }
+
+  Slot slots_[kSlots];
+  Stats http_;
+  int current_;
+  uint32_t clock_;  // setPattern() calls, for least recently used
+  uint32_t begun_[PHASE_COUNT];
+};
+
+#endif // RENDER_PROFILER_H
@@ -0,0 +1,321 @@
+#ifndef SIM_LIB8TION_H
+#define SIM_LIB8TION_H
+
+// Integer lib8tion for the simulator: bit-exact ports of the FastLED 3.6 C paths used on
+// the ESP8266 (FASTLED_SCALE8_FIXED=1, sin8_C/sin16_C, hsv2rgb_rainbow, noise helpers).
+// Keep these in sync with FastLED rather than "improving" them - the point is that a
+// simulator frame matches the device frame byte for byte. Included from platform.h
+// (SIMULATOR only).
+
+#include <cstdint>
+
+// ---- scaling ----
+
+inline uint8_t scale8(uint8_t i, uint8_t scale) {
+  return (uint8_t)(((uint16_t)i * (1 + (uint16_t)scale)) >> 8);
+}
+
+// Never scales a non-zero value to zero.
+inline uint8_t scale8_video(uint8_t i, uint8_t scale) {
+  return (uint8_t)((((int)i * (int)scale) >> 8) + ((i && scale) ? 1 : 0));
+}
+
+inline uint16_t scale16(uint16_t i, uint16_t scale) {
+  return (uint16_t)(((uint32_t)i * (1 + (uint32_t)scale)) >> 16);
+}
+
+inline void nscale8x3(uint8_t& r, uint8_t& g, uint8_t& b, uint8_t scale) {
+  uint16_t scale_fixed = scale + 1;
+  r = (uint8_t)((r * scale_fixed) >> 8);
+  g = (uint8_t)((g * scale_fixed) >> 8);
+  b = (uint8_t)((b * scale_fixed) >> 8);
+}
+
+inline uint8_t qadd8(uint8_t a, uint8_t b) {
+  unsigned int sum = a + b;
+  if (sum > 255) sum = 255;
+  return sum;
+}
+
+inline uint8_t qsub8(uint8_t a, uint8_t b) {
+  if (a < b) return 0;
+  return a - b;
+}
+
+inline int8_t avg7(int8_t i, int8_t j) {
+  return (i >> 1) + (j >> 1) + (i & 0x1);
+}
+
+inline int16_t avg15(int16_t i, int16_t j) {
+  return (i >> 1) + (j >> 1) + (i & 0x1);
+}
+
+inline int8_t lerp7by8(int8_t a, int8_t b, uint8_t frac) {
+  if (b > a) {
+    uint8_t delta = b - a;
+    return a + scale8(delta, frac);
+  }
+  uint8_t delta = a - b;
+  return a - scale8(delta, frac);
+}
+
+inline int16_t lerp15by16(int16_t a, int16_t b, uint16_t frac) {
+  if (b > a) {
+    uint16_t delta = b - a;
+    return a + scale16(delta, frac);
+  }
+  uint16_t delta = a - b;
+  return a - scale16(delta, frac);
+}
+
+// ---- easing ----
+
+inline uint8_t ease8InOutQuad(uint8_t i) {
+  uint8_t j = i;
+  if (j & 0x80) j = 255 - j;
+  uint8_t jj = scale8(j, j);
+  uint8_t jj2 = jj << 1;
+  if (i & 0x80) jj2 = 255 - jj2;
+  return jj2;
+}
+
+inline uint16_t ease16InOutQuad(uint16_t i) {
+  uint16_t j = i;
+  if (j & 0x8000) j = 65535 - j;
+  uint16_t jj = scale16(j, j);
+  uint16_t jj2 = jj << 1;
+  if (i & 0x8000) jj2 = 65535 - jj2;
+  return jj2;
+}
+
+// ---- random (lib8tion/random8.h) ----
+
+// 16-bit LCG state shared by random8/random16, as in FastLED. PatternInstance swaps in a
+// per-pattern stream around each render (pattern_registry.h).
+inline uint16_t rand16seed = 1337;
+
+inline uint16_t random16() {
+  rand16seed = (uint16_t)(rand16seed * 2053 + 13849);
+  return rand16seed;
+}
+
+// Sum of the high and low bytes, for better mixing
+inline uint8_t random8() {
+  rand16seed = (uint16_t)(rand16seed * 2053 + 13849);
+  return (uint8_t)((uint8_t)(rand16seed & 0xFF) + (uint8_t)(rand16seed >> 8));
+}
+
+// 0..lim-1
+inline uint8_t random8(uint8_t lim) {
+  return (uint8_t)((random8() * lim) >> 8);
+}
+
+// min..lim-1
+inline uint8_t random8(uint8_t min, uint8_t lim) {
+  uint8_t delta = lim - min;
+  return random8(delta) + min;
+}
+
+inline uint16_t random16(uint16_t lim) {
+  return (uint16_t)(((uint32_t)lim * random16()) >> 16);
+}
+
+inline uint16_t random16(uint16_t min, uint16_t lim) {
+  uint16_t delta = lim - min;
+  return random16(delta) + min;
+}
+
+inline void random16_set_seed(uint16_t seed) { rand16seed = seed; }
+inline uint16_t random16_get_seed() { return rand16seed; }
+inline void random16_add_entropy(uint16_t entropy) { rand16seed += entropy; }
+
+// ---- trig ----
+
+// sin8_C: piecewise linear over 4 sections of a quarter wave.
+inline uint8_t sin8(uint8_t theta) {
+  static const uint8_t b_m16_interleave[] = { 0, 49, 49, 41, 90, 27, 117, 10 };
+
+  uint8_t offset = theta;
+  if (theta & 0x40) {
+    offset = (uint8_t)255 - offset;
+  }
+  offset &= 0x3F; // 0..63
+
+  uint8_t secoffset = offset & 0x0F; // 0..15
+  if (theta & 0x40) secoffset++;
+
+  uint8_t section = offset >> 4; // 0..3
+  uint8_t b = b_m16_interleave[section * 2];
+  uint8_t m16 = b_m16_interleave[section * 2 + 1];
+
+  uint8_t mx = (m16 * secoffset) >> 4;
+
+  int8_t y = mx + b;
+  if (theta & 0x80) y = -y;
+
+  y += 128;
+  return (uint8_t)y;
+}
+
+inline uint8_t cos8(uint8_t theta) {
+  return sin8(theta + 64);
+}
+
+// sin16_C: 8 linear sections per quarter wave, result in -32767..32767.
+inline int16_t sin16(uint16_t theta) {
+  static const uint16_t base[] = { 0, 6393, 12539, 18204, 23170, 27245, 30273, 32137 };
+  static const uint8_t slope[] = { 49, 48, 44, 38, 31, 23, 14, 4 };
+
+  uint16_t offset = (theta & 0x3FFF) >> 3; // 0..2047
+  if (theta & 0x4000) offset = 2047 - offset;
+
+  uint8_t section = offset / 256; // 0..7
+  uint16_t b = base[section];
+  uint8_t m = slope[section];
+
+  uint8_t secoffset8 = (uint8_t)(offset) / 2;
+
+  uint16_t mx = m * secoffset8;
+  int16_t y = mx + b;
+
+  if (theta & 0x8000) y = -y;
+  return y;
+}
+
+inline int16_t cos16(uint16_t theta) {
+  return sin16(theta + 16384);
+}
+
+// ---- beats (millis() based, from platform.h) ----
+
+// bpm in Q8.8
+inline uint16_t beat88(uint16_t beats_per_minute_88, uint32_t timebase = 0) {
+  return (uint16_t)((((uint32_t)millis() - timebase) * beats_per_minute_88 * 280) >> 16);
+}
+
+// Values below 256 are plain BPM, larger ones Q8.8.
+inline uint16_t beat16(uint16_t beats_per_minute, uint32_t timebase = 0) {
+  if (beats_per_minute < 256) beats_per_minute <<= 8;
+  return beat88(beats_per_minute, timebase);
+}
+
+inline uint8_t beat8(uint16_t beats_per_minute, uint32_t timebase = 0) {
+  return beat16(beats_per_minute, timebase) >> 8;
+}
+
+inline uint8_t beatsin8(uint16_t beats_per_minute, uint8_t lowest = 0, uint8_t highest = 255,
+                        uint32_t timebase = 0, uint8_t phase_offset = 0) {
+  uint8_t beat = beat8(beats_per_minute, timebase);
+  uint8_t beatsin = sin8(beat + phase_offset);
+  uint8_t rangewidth = highest - lowest;
+  uint8_t scaledbeat = scale8(beatsin, rangewidth);
+  return lowest + scaledbeat;
+}
+
+inline uint16_t beatsin16(uint16_t beats_per_minute, uint16_t lowest = 0, uint16_t highest = 65535,
+                          uint32_t timebase = 0, uint16_t phase_offset = 0) {
+  uint16_t beat = beat16(beats_per_minute, timebase);
+  uint16_t beatsin = (uint16_t)(sin16(beat + phase_offset) + 32768);
+  uint16_t rangewidth = highest - lowest;
+  uint16_t scaledbeat = scale16(beatsin, rangewidth);
+  return lowest + scaledbeat;
+}
+
+// ---- color ----
+
+// hsv2rgb_rainbow (Y1 yellow boost, 2021 saturation curve).
+inline void hsv2rgb_rainbow(uint8_t hue, uint8_t sat, uint8_t val,
+                            uint8_t& outR, uint8_t& outG, uint8_t& outB) {
+  uint8_t offset8 = (hue & 0x1F) << 3;
+  uint8_t third = scale8(offset8, (256 / 3)); // max = 85
+  uint8_t r, g, b;
+
+  if (!(hue & 0x80)) {
+    if (!(hue & 0x40)) {
+      if (!(hue & 0x20)) {
+        // R -> O
+        r = 255 - third;
+        g = third;
+        b = 0;
+      } else {
+        // O -> Y
+        r = 171;
+        g = 85 + third;
+        b = 0;
+      }
+    } else {
+      if (!(hue & 0x20)) {
+        // Y -> G
+        uint8_t twothirds = scale8(offset8, ((256 * 2) / 3)); // max = 170
+        r = 171 - twothirds;
+        g = 170 + third;
+        b = 0;
+      } else {
+        // G -> A
+        r = 0;
+        g = 255 - third;
+        b = third;
+      }
+    }
+  } else {
+    if (!(hue & 0x40)) {
+      if (!(hue & 0x20)) {
+        // A -> B
+        uint8_t twothirds = scale8(offset8, ((256 * 2) / 3)); // max = 170
+        r = 0;
+        g = 171 - twothirds;
+        b = 85 + twothirds;
+      } else {
+        // B -> P
+        r = third;
+        g = 0;
+        b = 255 - third;
+      }
+    } else {
+      if (!(hue & 0x20)) {
+        // P -> K
+        r = 85 + third;
+        g = 0;
+        b = 171 - third;
+      } else {
+        // K -> R
+        r = 170 + third;
+        g = 0;
+        b = 85 - third;
+      }
+    }
+  }
+
+  if (sat != 255) {
+    if (sat == 0) {
+      r = 255; g = 255; b = 255;
+    } else {
+      uint8_t desat = 255 - sat;
+      desat = scale8_video(desat, desat);
+      uint8_t satscale = 255 - desat;
+      r = scale8(r, satscale);
+      g = scale8(g, satscale);
+      b = scale8(b, satscale);
+      r += desat;
+      g += desat;
+      b += desat;
+    }
+  }
+
+  if (val != 255) {
+    val = scale8_video(val, val);
+    if (val == 0) {
+      r = 0; g = 0; b = 0;
+    } else {
+      r = scale8(r, val);
+      g = scale8(g, val);
+      b = scale8(b, val);
+    }
+  }
+
+  outR = r;
+  outG = g;
+  outB = b;
+}
+
+#endif // SIM_LIB8TION_H
@@ -0,0 +1,131 @@
+#ifndef SIM_SIMD_H
+#define SIM_SIMD_H
+
+// Byte kernels behind the simulator's framebuffer helpers (fill_solid, nscale8,
+// fadeToBlackBy, blur1d in platform.h). A CRGB array is just r,g,b bytes back to back, and
+// every operation here is the same per channel, so the kernels work on flat byte runs.
+//
+// Built with -DSIM_SIMD (the default in scripts/build_sim_{native,wasm}.sh) they use
+// AVX2 / SSE2 on the host and SIMD128 under Emscripten (-msimd128), whichever the
+// compiler targets. The scalar loops are the fallback and handle the tails; every path
+// gives the same bytes as the sim_lib8tion.h scalar functions.
+
+#include <cstdint>
+
+#if defined(SIM_SIMD) && defined(__AVX2__)
+  #include <immintrin.h>
+  #define SIM_SIMD_AVX2 1
+  #define SIM_SIMD_SSE2 1
+#elif defined(SIM_SIMD) && defined(__SSE2__)
+  #include <emmintrin.h>
+  #define SIM_SIMD_SSE2 1
+#elif defined(SIM_SIMD) && defined(__wasm_simd128__)
+  #include <wasm_simd128.h>
+  #define SIM_SIMD_WASM 1
+#endif
+
+// p[i] = scale8(p[i], scale), FastLED's fixed scale8: (p * (scale + 1)) >> 8
+inline void scale8_bytes(uint8_t* p, int n, uint8_t scale) {
+  if (scale == 255) return;
+  const uint16_t mul = (uint16_t)scale + 1;
+  int i = 0;
+#if SIM_SIMD_AVX2
+  const __m256i m256 = _mm256_set1_epi16((short)mul);
+  const __m256i zero256 = _mm256_setzero_si256();
+  for (; i + 32 <= n; i += 32) {
+    __m256i v = _mm256_loadu_si256((const __m256i*)(p + i));
+    __m256i lo = _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(v, zero256), m256), 8);
+    __m256i hi = _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(v, zero256), m256), 8);
+    _mm256_storeu_si256((__m256i*)(p + i), _mm256_packus_epi16(lo, hi));
+  }
+#endif
+#if SIM_SIMD_SSE2
+  const __m128i m = _mm_set1_epi16((short)mul);
+  const __m128i zero = _mm_setzero_si128();
+  for (; i + 16 <= n; i += 16) {
+    __m128i v = _mm_loadu_si128((const __m128i*)(p + i));
+    __m128i lo = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(v, zero), m), 8);
+    __m128i hi = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(v, zero), m), 8);
+    _mm_storeu_si128((__m128i*)(p + i), _mm_packus_epi16(lo, hi));
+  }
+#elif SIM_SIMD_WASM
+  const v128_t m = wasm_i16x8_splat((int16_t)mul);
+  for (; i + 16 <= n; i += 16) {
+    v128_t v = wasm_v128_load(p + i);
+    v128_t lo = wasm_u16x8_shr(wasm_i16x8_mul(wasm_u16x8_extend_low_u8x16(v), m), 8);
+    v128_t hi = wasm_u16x8_shr(wasm_i16x8_mul(wasm_u16x8_extend_high_u8x16(v), m), 8);
+    wasm_v128_store(p + i, wasm_u8x16_narrow_i16x8(lo, hi));
+  }
+#endif
+  for (; i < n; i++) {
+    p[i] = (uint8_t)((p[i] * mul) >> 8);
+  }
+}
+
+// dst[i] = qadd8(dst[i], src[i])
+inline void qadd8_bytes(uint8_t* dst, const uint8_t* src, int n) {
+  int i = 0;
+#if SIM_SIMD_AVX2
+  for (; i + 32 <= n; i += 32) {
+    __m256i a = _mm256_loadu_si256((const __m256i*)(dst + i));
+    __m256i b = _mm256_loadu_si256((const __m256i*)(src + i));
+    _mm256_storeu_si256((__m256i*)(dst + i), _mm256_adds_epu8(a, b));
+  }
+#endif
+#if SIM_SIMD_SSE2
+  for (; i + 16 <= n; i += 16) {
+    __m128i a = _mm_loadu_si128((const __m128i*)(dst + i));
+    __m128i b = _mm_loadu_si128((const __m128i*)(src + i));
+    _mm_storeu_si128((__m128i*)(dst + i), _mm_adds_epu8(a, b));
+  }
+#elif SIM_SIMD_WASM
+  for (; i + 16 <= n; i += 16) {
+    wasm_v128_store(dst + i, wasm_u8x16_add_sat(wasm_v128_load(dst + i), wasm_v128_load(src + i)));
+  }
+#endif
+  for (; i < n; i++) {
+    unsigned int sum = dst[i] + src[i];
+    dst[i] = sum > 255 ? 255 : sum;
+  }
+}
+
+// Writes `count` copies of the 3-byte pixel (a, b, c) starting at p.
+inline void fill3_bytes(uint8_t* p, int count, uint8_t a, uint8_t b, uint8_t c) {
+  int i = 0;
+  const int n = count * 3;
+#if SIM_SIMD_SSE2 || SIM_SIMD_WASM
+  // 48 bytes = 16 pixels = three vectors with the pattern in phase
+  uint8_t pattern[48];
+  for (int k = 0; k < 48; k += 3) {
+    pattern[k] = a;
+    pattern[k + 1] = b;
+    pattern[k + 2] = c;
+  }
+#endif
+#if SIM_SIMD_SSE2
+  const __m128i v0 = _mm_loadu_si128((const __m128i*)pattern);
+  const __m128i v1 = _mm_loadu_si128((const __m128i*)(pattern + 16));
+  const __m128i v2 = _mm_loadu_si128((const __m128i*)(pattern + 32));
+  for (; i + 48 <= n; i += 48) {
+    _mm_storeu_si128((__m128i*)(p + i), v0);
+    _mm_storeu_si128((__m128i*)(p + i + 16), v1);
+    _mm_storeu_si128((__m128i*)(p + i + 32), v2);
+  }
+#elif SIM_SIMD_WASM
+  const v128_t v0 = wasm_v128_load(pattern);
+  const v128_t v1 = wasm_v128_load(pattern + 16);
+  const v128_t v2 = wasm_v128_load(pattern + 32);
+  for (; i + 48 <= n; i += 48) {
+    wasm_v128_store(p + i, v0);
+    wasm_v128_store(p + i + 16, v1);
+    wasm_v128_store(p + i + 32, v2);
+  }
+#endif
+  for (; i < n; i += 3) {
+    p[i] = a;
+    p[i + 1] = b;
+    p[i + 2] = c;
+  }
+}
+
+#endif // SIM_SIMD_H
@@ -0,0 +1,289 @@
+#ifndef SPARSE_JSON_PARSER_H
+#define SPARSE_JSON_PARSER_H
+
+#include "platform.h"
+
+// Push parser for the pattern designer's JSON upload
+//
+//   {"sparse":[[ledIndex,r,g,b],...],"scrollSpeed":80}
+//
+// fed with the body a block at a time as the web server receives it, writing pixels
+// straight into the LED buffer. A character-level state machine: it keeps no part of the
+// body, so its memory use is sizeof(SparseJsonParser) whatever the upload size.
+//
+//   parser.begin(customPattern, MAX_LEDS);
+//   parser.feed(raw.buf, raw.currentSize);   // for every block
+//   if (!parser.finish()) reply 400 with parser.error() at parser.errorOffset()
+//
+// Malformed input is rejected at the first bad byte (later blocks are ignored): records
+// must be exactly four non-negative integers with colors <= 255, and nothing but
+// whitespace may follow the closing brace. Indices past the buffer are dropped and counted,
+// as before. Keys other than "sparse" and "scrollSpeed" are skipped whatever their value.
+// begin() clears the buffer to black, so LEDs the upload does not mention are off.
+class SparseJsonParser {
+ public:
+  SparseJsonParser() : dest_(nullptr), count_(0) { reset(); }
+
+  void begin(CRGB* dest, int count) {
+    dest_ = dest;
+    count_ = count;
+    reset();
+    fill_solid(dest_, count_, CRGB::Black);
+  }
+
+  // Returns false once the input is known to be malformed
+  bool feed(const uint8_t* data, size_t len) {
+    size_t i = 0;
+    while (i < len && state_ != S_ERROR) {
+      if (state_ == S_FIELD_DIGITS) {
+        // Most of a body is record digits: take a run of them without the state switch
+        size_t run = i;
+        while (run < len && isDigit((char)data[run])) addDigit((char)data[run++]);
+        bytes_ += run - i;
+        i = run;
+        if (i == len) break;
+      }
+      step((char)data[i++]);
+      bytes_++;
+    }
+    return state_ != S_ERROR;
+  }
+
+  bool feed(const char* data, size_t len) { return feed(reinterpret_cast<const uint8_t*>(data), len); }
+
+  // True if the body was one complete upload object; sets error() otherwise
+  bool finish() {
+    if (state_ == S_ERROR) return false;
+    if (state_ != S_DONE) return fail("unexpected end of body");
+    if (!sawSparse_) return fail("missing sparse array");
+    return true;
+  }
+
+  uint32_t bytes() const { return bytes_; }
+  uint32_t pixels() const { return pixels_; }
+  uint32_t dropped() const { return dropped_; }
+  // "scrollSpeed" of the upload, -1 if it had none
+  long scrollSpeed() const { return scrollSpeed_; }
+  // Why the body was rejected and at which byte (nullptr / 0 if it was not)
+  const char* error() const { return error_; }
+  uint32_t errorOffset() const { return errorOffset_; }
+
+ private:
+  enum State : uint8_t {
+    S_START,          // '{'
+    S_FIRST_KEY,      // '"' or '}'
+    S_KEY_START,      // '"'
+    S_KEY,            // key characters
+    S_KEY_ESCAPE,     // character after '\' in a key
+    S_COLON,          // ':'
+    S_VALUE,          // value of the current key
+    S_AFTER_VALUE,    // ',' or '}'
+    S_SPARSE_FIRST,   // '[' of the first record or ']'
+    S_RECORD,         // '[' of a record
+    S_FIELD,          // first digit of a record field
+    S_FIELD_DIGITS,
+    S_FIELD_END,      // ',' or ']' after a field
+    S_AFTER_RECORD,   // ',' or ']'
+    S_SPEED,          // first digit of scrollSpeed
+    S_SPEED_DIGITS,
+    S_SKIP,           // value of an unknown key
+    S_DONE,
+    S_ERROR,
+  };
+  enum Key : uint8_t { KEY_OTHER, KEY_SPARSE, KEY_SCROLL_SPEED };
+
+  static const int kMaxKey = 12;             // longest key we look for, "scrollSpeed"
+  static const uint32_t kMaxNumber = 0xFFFFF;  // numbers saturate here (indices, scrollSpeed)
+
+  void reset() {
+    state_ = S_START;
+    key_ = KEY_OTHER;
+    keyLen_ = 0;
+    sawSparse_ = false;
+    field_ = 0;
+    number_ = 0;
+    skipDepth_ = 0;
+    skipString_ = false;
+    skipEscape_ = false;
+    bytes_ = pixels_ = dropped_ = 0;
+    scrollSpeed_ = -1;
+    error_ = nullptr;
+    errorOffset_ = 0;
+  }
+
+  static bool isSpace(char c) { return c == ' ' || c == '\n' || c == '\r' || c == '\t'; }
+  static bool isDigit(char c) { return c >= '0' && c <= '9'; }
+
+  bool fail(const char* why) {
+    state_ = S_ERROR;
+    error_ = why;
+    errorOffset_ = bytes_;
+    return false;
+  }
+
+  void addDigit(char c) {
+    number_ = number_ * 10 + (c - '0');
+    if (number_ > kMaxNumber) number_ = kMaxNumber;
+  }
+
+  // Ends a record field; false if a color is out of range
+  bool endField() {
+    if (field_ > 0 && number_ > 255) return fail("color value above 255");
+    record_[field_++] = number_;
+    if (field_ < 4) return true;
+    if (record_[0] < (uint32_t)count_) {
+      dest_[record_[0]] = CRGB(record_[1], record_[2], record_[3]);
+      pixels_++;
+    } else {
+      dropped_++;
+    }
+    return true;
+  }
+
+  void endKey() {
+    key_ = KEY_OTHER;
+    if (keyLen_ <= kMaxKey) {
+      keyText_[keyLen_] = '\0';
+      if (strcmp(keyText_, "sparse") == 0) key_ = KEY_SPARSE;
+      else if (strcmp(keyText_, "scrollSpeed") == 0) key_ = KEY_SCROLL_SPEED;
+    }
+    state_ = S_COLON;
+  }
+
+  void step(char c) {
+    switch (state_) {
+      case S_START:
+        if (c == '{') state_ = S_FIRST_KEY;
+        else if (!isSpace(c)) fail("expected '{'");
+        break;
+      case S_FIRST_KEY:
+        if (c == '}') state_ = S_DONE;
+        else if (c == '"') { keyLen_ = 0; state_ = S_KEY; }
+        else if (!isSpace(c)) fail("expected a key");
+        break;
+      case S_KEY_START:
+        if (c == '"') { keyLen_ = 0; state_ = S_KEY; }
+        else if (!isSpace(c)) fail("expected a key");
+        break;
+      case S_KEY:
+        if (c == '"') endKey();
+        else if (c == '\\') state_ = S_KEY_ESCAPE;
+        else if (keyLen_ < kMaxKey) keyText_[keyLen_++] = c;
+        else keyLen_ = kMaxKey + 1;  // too long to be one of ours
+        break;
+      case S_KEY_ESCAPE:
+        keyLen_ = kMaxKey + 1;  // none of our keys has escapes
+        state_ = S_KEY;
+        break;
+      case S_COLON:
+        if (c == ':') state_ = S_VALUE;
+        else if (!isSpace(c)) fail("expected ':'");
+        break;
+      case S_VALUE:
+        if (isSpace(c)) break;
+        if (key_ == KEY_SPARSE) {
+          if (c != '[') { fail("sparse must be an array"); break; }
+          sawSparse_ = true;
+          state_ = S_SPARSE_FIRST;
+        } else if (key_ == KEY_SCROLL_SPEED) {
+          state_ = S_SPEED;
+          step(c);
+        } else {
+          skipDepth_ = 0;
+          skipString_ = skipEscape_ = false;
+          state_ = S_SKIP;
+          step(c);
+        }
+        break;
+      case S_AFTER_VALUE:
+        if (c == ',') state_ = S_KEY_START;
+        else if (c == '}') state_ = S_DONE;
+        else if (!isSpace(c)) fail("expected ',' or '}'");
+        break;
+      case S_SPARSE_FIRST:
+        if (c == ']') state_ = S_AFTER_VALUE;
+        else { state_ = S_RECORD; step(c); }
+        break;
+      case S_RECORD:
+        if (c == '[') { field_ = 0; state_ = S_FIELD; }
+        else if (!isSpace(c)) fail("expected '[' of a record");
+        break;
+      case S_FIELD:
+        if (isDigit(c)) { number_ = 0; addDigit(c); state_ = S_FIELD_DIGITS; }
+        else if (!isSpace(c)) fail("expected a non-negative integer");
+        break;
+      case S_FIELD_DIGITS:
+        if (isDigit(c)) { addDigit(c); break; }
+        if (!endField()) break;
+        state_ = S_FIELD_END;
+        step(c);
+        break;
+      case S_FIELD_END:
+        if (c == ',' && field_ < 4) state_ = S_FIELD;
+        else if (c == ']' && field_ == 4) state_ = S_AFTER_RECORD;
+        else if (!isSpace(c)) fail(field_ < 4 ? "record needs [index,r,g,b]" : "record has more than 4 values");
+        break;
+      case S_AFTER_RECORD:
+        if (c == ',') state_ = S_RECORD;
+        else if (c == ']') state_ = S_AFTER_VALUE;
+        else if (!isSpace(c)) fail("expected ',' or ']' after a record");
+        break;
+      case S_SPEED:
+        if (isDigit(c)) { number_ = 0; addDigit(c); state_ = S_SPEED_DIGITS; }
+        else fail("scrollSpeed must be a non-negative integer");
+        break;
+      case S_SPEED_DIGITS:
+        if (isDigit(c)) { addDigit(c); break; }
+        scrollSpeed_ = (long)number_;
+        state_ = S_AFTER_VALUE;
+        step(c);
+        break;
+      case S_SKIP:
+        // Any JSON value: strings (with escapes) and nesting are tracked, scalars run to
+        // the next delimiter at depth 0
+        if (skipString_) {
+          if (skipEscape_) skipEscape_ = false;
+          else if (c == '\\') skipEscape_ = true;
+          else if (c == '"') skipString_ = false;
+        } else if (c == '"') {
+          skipString_ = true;
+        } else if (c == '[' || c == '{') {
+          if (++skipDepth_ == 0) fail("nested too deep");
+        } else if (c == ']' || c == '}') {
+          if (skipDepth_ == 0) { state_ = S_AFTER_VALUE; step(c); }
+          else skipDepth_--;
+        } else if (c == ',' && skipDepth_ == 0) {
+          state_ = S_AFTER_VALUE;
+          step(c);
+        }
+        break;
+      case S_DONE:
+        if (!isSpace(c)) fail("data after the closing '}'");
+        break;
+      case S_ERROR:
+        break;
+    }
+  }
+
+  CRGB* dest_;
+  int count_;
+  State state_;
+  Key key_;
+  char keyText_[kMaxKey + 1];
+  int keyLen_;
+  bool sawSparse_;
+  int field_;
+  uint32_t record_[4];
+  uint32_t number_;
+  uint8_t skipDepth_;
+  bool skipString_;
+  bool skipEscape_;
+  uint32_t bytes_;
+  uint32_t pixels_;
+  uint32_t dropped_;
+  long scrollSpeed_;
+  const char* error_;
+  uint32_t errorOffset_;
+};
+
+#endif // SPARSE_JSON_PARSER_H